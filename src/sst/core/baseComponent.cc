@@ -33,6 +33,88 @@
 
 namespace SST {
 
+/**
+   Wakes the gated clocks of a component when an event arrives on one
+   of its links.  It is attached to the event handlers like a profile
+   tool, so events that were already on their way when a clock was
+   gated wake it too.
+ */
+class BaseComponent::ClockGate : public HandlerProfileToolAPI
+{
+public:
+    struct GatedClock
+    {
+        TimeConverter*      tc;
+        Clock::HandlerBase* handler;
+        // Cycle the handler would have been called on next
+        Cycle_t             next_cycle;
+    };
+
+    ClockGate(BaseComponent* comp) : HandlerProfileToolAPI("clock_gate"), comp(comp) {}
+
+    uintptr_t registerHandler(const HandlerMetaData& UNUSED(mdata)) override { return 0; }
+
+    void handlerStart(uintptr_t UNUSED(key)) override
+    {
+        if ( gated.empty() ) return;
+        for ( auto& clock : gated ) {
+            wake(clock, comp->sim_->reregisterClock(clock.tc, clock.handler, CLOCKPRIORITY));
+        }
+        gated.clear();
+    }
+
+    void outputData(FILE* UNUSED(fp)) override {}
+
+    // Count the cycles skipped before the handler's next call
+    void wake(const GatedClock& clock, Cycle_t next_cycle)
+    {
+        if ( next_cycle > clock.next_cycle ) clock.handler->handlerSkipped(next_cycle - clock.next_cycle);
+    }
+
+    // Hook the gate into the event handlers of the links of info and
+    // its SubComponents that don't have it yet.  Returns the number of
+    // links with a handler, hooked now or before.
+    size_t watch(ComponentInfo* info)
+    {
+        size_t count = 0;
+        if ( nullptr != info->link_map ) {
+            for ( auto& p : info->link_map->getLinkMap() ) {
+                Link* link = p.second;
+                if ( Link::HANDLER != link->type || 0 == link->pair_link->delivery_info ) continue;
+
+                count++;
+                auto* event_handler = reinterpret_cast<Event::HandlerBase*>(link->pair_link->delivery_info);
+                if ( event_handler->hasProfileTool(this) ) continue;
+
+                EventHandlerMetaData mdata(info->getID(), info->getName(), info->getType(), p.first);
+                event_handler->addProfileTool(this, mdata);
+            }
+        }
+        for ( auto& sub : info->subComponents ) {
+            count += watch(&sub.second);
+        }
+        return count;
+    }
+
+    // Remove a handler from the gated list, returns false if it wasn't there
+    bool remove(Clock::HandlerBase* handler, GatedClock& clock)
+    {
+        for ( auto it = gated.begin(); it != gated.end(); ++it ) {
+            if ( it->handler == handler ) {
+                clock = *it;
+                gated.erase(it);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<GatedClock> gated;
+
+private:
+    BaseComponent* comp;
+};
+
 BaseComponent::BaseComponent(ComponentId_t id) :
     my_info(Simulation_impl::getSimulation()->getComponentInfo(id)),
     sim_(Simulation_impl::getSimulation()),
@@ -47,6 +129,8 @@ BaseComponent::BaseComponent(ComponentId_t id) :
 
 BaseComponent::~BaseComponent()
 {
+    delete clock_gate_;
+
     // Need to cleanup my ComponentInfo and delete all my children.
 
     // If my_info is nullptr, then we are being deleted by our
@@ -178,7 +262,12 @@ BaseComponent::registerClock(TimeConverter* tc, Clock::HandlerBase* handler, boo
 Cycle_t
 BaseComponent::reregisterClock(TimeConverter* freq, Clock::HandlerBase* handler)
 {
-    return sim_->reregisterClock(freq, handler, CLOCKPRIORITY);
+    Cycle_t next_cycle = sim_->reregisterClock(freq, handler, CLOCKPRIORITY);
+
+    // Woken by hand before an event arrived
+    ClockGate::GatedClock clock;
+    if ( clock_gate_ && clock_gate_->remove(handler, clock) ) clock_gate_->wake(clock, next_cycle);
+    return next_cycle;
 }
 
 Cycle_t
@@ -191,6 +280,41 @@ void
 BaseComponent::unregisterClock(TimeConverter* tc, Clock::HandlerBase* handler)
 {
     sim_->unregisterClock(tc, handler, CLOCKPRIORITY);
+
+    // An unregistered clock isn't woken by events
+    ClockGate::GatedClock clock;
+    if ( clock_gate_ ) clock_gate_->remove(handler, clock);
+}
+
+void
+BaseComponent::requestUntimedPhase()
+{
+    sim_->requestUntimedPhase(my_info);
+}
+
+void
+BaseComponent::gateClock(TimeConverter* tc, Clock::HandlerBase* handler)
+{
+    if ( nullptr == clock_gate_ ) clock_gate_ = new ClockGate(this);
+
+    // Watch all the links that deliver to a handler, including those of
+    // SubComponents.  This is redone on every call to pick up links
+    // configured and handlers set since the last one.
+    if ( 0 == clock_gate_->watch(my_info) ) {
+        sim_->getSimulationOutput().fatal(
+            CALL_INFO, 1,
+            "ERROR: gateClock() called by %s, but neither it nor its SubComponents have links with event handlers, "
+            "so the clock would never be woken\n",
+            getName().c_str());
+    }
+
+    for ( auto& clock : clock_gate_->gated ) {
+        if ( clock.handler == handler ) return;
+    }
+
+    Cycle_t next_cycle = sim_->getNextClockCycle(tc, CLOCKPRIORITY);
+    sim_->unregisterClock(tc, handler, CLOCKPRIORITY);
+    clock_gate_->gated.push_back({ tc, handler, next_cycle });
 }
 
 TimeConverter*
@@ -764,12 +888,11 @@ BaseComponent::createExplicitlyEnabledStatistic(
             name.c_str());
     }
 
-    auto piter = my_info->statConfigs->find(id);
-    if ( piter == my_info->statConfigs->end() ) {
+    if ( !my_info->statConfigs->contains(id) ) {
         out.fatal(
             CALL_INFO, 1, "Explicitly enabled statistic '%s' does not have parameters mapped to its ID", name.c_str());
     }
-    auto& cfg = piter->second;
+    auto& cfg = (*my_info->statConfigs)[id];
     if ( cfg.shared ) {
         auto iter = m_explicitlyEnabledSharedStats.find(id);
         if ( iter != m_explicitlyEnabledSharedStats.end() ) { return iter->second; }
@@ -93,6 +93,13 @@ public:
      The method will be called each phase of complete. Complete phase
      ends when no components have sent any data. */
     virtual void complete(unsigned int UNUSED(phase)) {}
+    /** With --untimed-quiescence, init() and complete() are only
+     called after phase 0 for Components that were sent untimed data
+     in the previous phase.  Call this from init() or complete() to be
+     called in the next phase anyway.  It does not keep the phases
+     going if no Component sent any data.  Has no effect without
+     --untimed-quiescence. */
+    void requestUntimedPhase();
     /** Called after all components have been constructed and
     initialization has completed, but before simulation time has
     begun. */
@@ -306,6 +313,22 @@ protected:
     /** Removes a clock handler from the component */
     void unregisterClock(TimeConverter* tc, Clock::HandlerBase* handler);
 
+    /** Stops calling a clock handler until an event arrives on one of
+        the links of this (Sub)Component or its SubComponents, at
+        which point the core reregisters it.  The handler is next
+        called on the first cycle of the clock after the event arrives.
+        Can be called from the clock handler itself.  Events on polling
+        links don't wake the clock.  The links are looked up on each
+        call, so handlers set with setFunctor() after the last call are
+        not watched; replaceFunctor() keeps watching.  It is a fatal
+        error if there are no links with handlers.  The number of
+        skipped cycles is reported to the clock handler profile
+        tools.
+        @param tc TimeConverter the handler was registered with
+        @param handler Clock handler to stop
+    */
+    void gateClock(TimeConverter* tc, Clock::HandlerBase* handler);
+
     /** Reactivates an existing Clock and Handler
      * @return time of next time clock handler will fire
      *
@@ -870,8 +893,11 @@ protected:
     std::vector<Profile::ComponentProfileTool*> getComponentProfileTools(const std::string& point);
 
 private:
-    ComponentInfo*   my_info = nullptr;
-    Simulation_impl* sim_    = nullptr;
+    class ClockGate;
+
+    ComponentInfo*   my_info     = nullptr;
+    Simulation_impl* sim_        = nullptr;
+    ClockGate*       clock_gate_ = nullptr;
     bool             isExtension;
 
     void  addSelfLink(const std::string& name);
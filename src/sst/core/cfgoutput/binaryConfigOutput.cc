@@ -0,0 +1,156 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+//
+
+#include "sst_config.h"
+
+#include "sst/core/cfgoutput/binaryConfigOutput.h"
+
+#include "sst/core/config.h"
+#include "sst/core/configGraph.h"
+#include "sst/core/configGraphOutput.h"
+#include "sst/core/serialization/serializer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace SST::Core;
+
+// Number of components in each section, which bounds the memory used
+// to serialize them
+static const size_t section_size = 4096;
+
+BinaryConfigGraphOutput::BinaryConfigGraphOutput(const char* path, uint32_t rank) : ConfigGraphOutput(path), rank(rank)
+{}
+
+namespace {
+
+// Writes to the output file, keeping track of the offset
+class BinaryWriter
+{
+public:
+    BinaryWriter(FILE* file) : file(file), offset(0) {}
+
+    void write(const void* data, size_t size)
+    {
+        if ( size > 0 && fwrite(data, 1, size, file) != size ) {
+            throw ConfigGraphOutputException("Error writing binary configuration graph");
+        }
+        offset += size;
+    }
+
+    // Pad so the next write starts on an 8 byte boundary
+    void align()
+    {
+        static const char zeros[8] = {};
+        write(zeros, (8 - offset % 8) % 8);
+    }
+
+    uint64_t getOffset() const { return offset; }
+
+private:
+    FILE*    file;
+    uint64_t offset;
+};
+
+} // namespace
+
+void
+BinaryConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph)
+{
+    if ( nullptr == outputFile ) { throw ConfigGraphOutputException("Output file is not open for writing"); }
+
+    BinaryWriter      writer(outputFile);
+    BinaryGraphHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "SSTGRAPH", sizeof(header.magic));
+    header.version   = BinaryGraphHeader::current_version;
+    header.num_ranks = cfg->num_ranks();
+
+    // The header is filled in and written again at the end
+    writer.write(&header, sizeof(header));
+
+    // Program options, in the same form as the other outputs
+    std::vector<std::pair<std::string, std::string>> options = {
+        { "verbose", std::to_string(cfg->verbose()) },
+        { "stop-at", cfg->stop_at() },
+        { "print-timing-info", cfg->print_timing() ? "true" : "false" },
+        { "heartbeat-period", cfg->heartbeatPeriod() },
+        { "timebase", cfg->timeBase() },
+        { "partitioner", cfg->partitioner() },
+        { "imbalance-tolerance", std::to_string(cfg->imbalance_tolerance()) },
+        { "timeVortex", cfg->timeVortex() },
+        { "interthread-links", cfg->interthread_links() ? "true" : "false" },
+        { "shared-memory-ranks", cfg->shared_memory_ranks() ? "true" : "false" },
+        { "async-rank-sync", cfg->async_rank_sync() ? "true" : "false" },
+        { "per-peer-lookahead", cfg->per_peer_lookahead() ? "true" : "false" },
+        { "fifo-links", cfg->fifo_links() ? "true" : "false" },
+        { "untimed-quiescence", cfg->untimed_quiescence() ? "true" : "false" },
+        { "barrier-type", cfg->barrier_type() },
+        { "barrier-wait", cfg->barrier_wait() },
+        { "output-prefix-core", cfg->output_core_prefix() },
+    };
+
+    std::vector<char>                    buffer;
+    SST::Core::Serialization::serializer ser;
+    ser.start_packing(buffer);
+    ser& options;
+    serializeParamKeyMaps(ser);
+
+    header.globals_offset = writer.getOffset();
+    header.globals_size   = ser.size();
+    writer.write(buffer.data(), ser.size());
+
+    // Each rank is split into sections in the same way the graph is
+    // split into chunks to send to the ranks
+    std::vector<std::vector<ComponentId_t>> rank_ids = graph->getComponentIdsByRank(cfg->num_ranks());
+    std::vector<BinaryGraphSection>         sections;
+    for ( uint32_t r = 0; r < cfg->num_ranks(); r++ ) {
+        if ( rank != ALL_RANKS && r != rank ) continue;
+        const std::vector<ComponentId_t>& ids = rank_ids[r];
+
+        // The first section of a rank carries the statistic
+        // configuration, so there is always one
+        size_t num_sections = std::max<size_t>(1, (ids.size() + section_size - 1) / section_size);
+        for ( size_t i = 0; i < num_sections; i++ ) {
+            size_t                     first = std::min(ids.size(), i * section_size);
+            size_t                     last  = std::min(ids.size(), first + section_size);
+            std::vector<ComponentId_t> section_ids(ids.begin() + first, ids.begin() + last);
+
+            ConfigGraph* chunk = graph->getChunk(r, section_ids, i == 0);
+            ser.start_packing(buffer);
+            ser& *chunk;
+            graph->releaseChunk(chunk);
+
+            writer.align();
+            BinaryGraphSection section;
+            section.rank           = r;
+            section.num_components = section_ids.size();
+            section.offset         = writer.getOffset();
+            section.size           = ser.size();
+            writer.write(buffer.data(), ser.size());
+            sections.push_back(section);
+        }
+    }
+
+    writer.align();
+    header.sections_offset = writer.getOffset();
+    header.num_sections    = sections.size();
+    writer.write(sections.data(), sections.size() * sizeof(BinaryGraphSection));
+
+    if ( fseek(outputFile, 0, SEEK_SET) != 0 ) {
+        throw ConfigGraphOutputException("Error writing binary configuration graph");
+    }
+    writer.write(&header, sizeof(header));
+}
@@ -0,0 +1,77 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+//
+
+#ifndef SST_CORE_BINARY_CONFIG_OUTPUT_H
+#define SST_CORE_BINARY_CONFIG_OUTPUT_H
+
+#include "sst/core/configGraph.h"
+#include "sst/core/configGraphOutput.h"
+
+#include <cstdint>
+#include <limits>
+
+namespace SST {
+namespace Core {
+
+/**
+ * Header at the start of a binary configuration graph file.
+ *
+ * The header is followed by the serialized program options and
+ * parameter key tables, then by the sections, each holding a chunk
+ * of the graph made by ConfigGraph::getChunk() for one rank, and
+ * finally by the table of sections.  The fields are in the byte
+ * order of the machine that wrote the file.
+ */
+struct BinaryGraphHeader
+{
+    static constexpr uint32_t current_version = 1;
+
+    char     magic[8];        // "SSTGRAPH"
+    uint32_t version;         // Format version
+    uint32_t num_ranks;       // Number of ranks the graph was partitioned into
+    uint64_t globals_offset;  // Offset of the program options and key tables
+    uint64_t globals_size;    // Size of the program options and key tables
+    uint64_t sections_offset; // Offset of the table of sections
+    uint64_t num_sections;    // Number of entries in the table of sections
+};
+
+/** Entry in the table of sections of a binary configuration graph file */
+struct BinaryGraphSection
+{
+    uint32_t rank;           // Rank of the components in the section
+    uint32_t num_components; // Number of components in the section, not counting ghosts
+    uint64_t offset;         // Offset of the serialized chunk
+    uint64_t size;           // Size of the serialized chunk
+};
+
+class BinaryConfigGraphOutput : public ConfigGraphOutput
+{
+
+public:
+    static constexpr uint32_t ALL_RANKS = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * @param path File to write to
+     * @param rank Rank to write the sections for.  Used for parallel
+     * output, where each rank only has its own part of the graph.
+     */
+    BinaryConfigGraphOutput(const char* path, uint32_t rank = ALL_RANKS);
+    virtual void generate(const Config* cfg, ConfigGraph* graph) override;
+
+private:
+    uint32_t rank;
+};
+
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_BINARY_CONFIG_OUTPUT_H
@@ -18,16 +18,45 @@
 #include "sst/core/configGraph.h"
 #include "sst/core/configGraphOutput.h"
 #include "sst/core/params.h"
+#include "sst/core/warnmacros.h"
 
 #include "nlohmann/json.hpp"
 
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+#include <algorithm>
 #include <map>
-#include <sstream>
+#include <string>
+#include <vector>
 
 using namespace SST::Core;
 namespace json = ::nlohmann;
 
-JSONConfigGraphOutput::JSONConfigGraphOutput(const char* path) : ConfigGraphOutput(path) {}
+JSONConfigGraphOutput::JSONConfigGraphOutput(const char* path) :
+    ConfigGraphOutput(path),
+    path(path),
+    rank(0),
+    num_ranks(1),
+    shared(false)
+{}
+
+JSONConfigGraphOutput::JSONConfigGraphOutput(const char* path, uint32_t rank, uint32_t num_ranks) :
+    ConfigGraphOutput(),
+    path(path),
+    rank(rank),
+    num_ranks(num_ranks),
+    shared(num_ranks > 1)
+{
+#ifndef SST_CONFIG_HAVE_MPI
+    shared = false;
+#endif
+    // The shared file is opened by all the ranks together in generate()
+    if ( !shared ) openFile(path);
+}
 
 namespace {
 struct CompWrapper
@@ -69,7 +98,7 @@ void
 to_json(json::ordered_json& j, SubCompWrapper const& comp_wrapper)
 {
     auto& comp = comp_wrapper.comp;
-    j = json::ordered_json { { "slot_name", comp->name }, { "slot_number", comp->slot_num }, { "type", comp->type } };
+    j = json::ordered_json { { "slot_name", comp->name }, { "slot_number", comp->slot_num }, { "type", comp->type.get() } };
 
     for ( auto const& paramsItr : comp->getParamsLocalKeys() ) {
         j["params"][paramsItr] = comp->params.find<std::string>(paramsItr);
@@ -92,7 +121,7 @@ void
 to_json(json::ordered_json& j, CompWrapper const& comp_wrapper)
 {
     auto& comp = comp_wrapper.comp;
-    j          = json::ordered_json { { "name", comp->name }, { "type", comp->type } };
+    j          = json::ordered_json { { "name", comp->name }, { "type", comp->type.get() } };
 
     for ( auto const& paramsItr : comp->getParamsLocalKeys() ) {
         j["params"][paramsItr] = comp->params.find<std::string>(paramsItr);
@@ -129,64 +158,226 @@ to_json(json::ordered_json& j, LinkConfPair const& pair)
         j = json::ordered_json { { "name", link->name } };
 
     j["left"]["component"]  = graph->findComponent(link->component[0])->getFullName();
-    j["left"]["port"]       = link->port[0];
-    j["left"]["latency"]    = link->latency_str[0];
+    j["left"]["port"]       = link->port[0].get();
+    j["left"]["latency"]    = link->latency_str[0].get();
     j["right"]["component"] = graph->findComponent(link->component[1])->getFullName();
-    j["right"]["port"]      = link->port[1];
-    j["right"]["latency"]   = link->latency_str[1];
+    j["right"]["port"]      = link->port[1].get();
+    j["right"]["latency"]   = link->latency_str[1].get();
 }
 
-} // namespace
+// Append text to out, indenting every line after the first
+void
+appendIndented(std::string& out, const std::string& text, const char* indent)
+{
+    size_t start = 0;
+    size_t end;
+    while ( (end = text.find('\n', start)) != std::string::npos ) {
+        out.append(text, start, end + 1 - start);
+        out.append(indent);
+        start = end + 1;
+    }
+    out.append(text, start, std::string::npos);
+}
 
+// Append an element of the components or links array.  The layout is
+// the same as dumping the whole document with an indent of 2.
+template <typename T>
 void
-JSONConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph)
+appendElement(std::string& out, const T& item, bool first)
 {
-    if ( nullptr == outputFile ) { throw ConfigGraphOutputException("Output file is not open for writing"); }
+    json::ordered_json j = item;
+    out.append(first ? "\n    " : ",\n    ");
+    appendIndented(out, j.dump(2), "    ");
+}
 
-    const auto& compMap = graph->getComponentMap();
-    const auto& linkMap = graph->getLinkMap();
+// Closes the array, which has count elements
+std::string
+arrayEnd(uint64_t count)
+{
+    return count == 0 ? "]" : "\n  ]";
+}
+
+void
+writeString(FILE* file, const std::string& str)
+{
+    if ( str.size() > 0 && fwrite(str.data(), 1, str.size(), file) != str.size() ) {
+        throw ConfigGraphOutputException("Error writing JSON configuration graph");
+    }
+}
 
-    json::ordered_json outputJson;
+} // namespace
 
-    // Put in the program options
-    outputJson["program_options"]["verbose"]            = std::to_string(cfg->verbose());
-    outputJson["program_options"]["stop-at"]            = cfg->stop_at();
-    outputJson["program_options"]["print-timing-info"]  = cfg->print_timing() ? "true" : "false";
+// Everything before the elements of the components array
+std::string
+JSONConfigGraphOutput::documentStart(const Config* cfg)
+{
+    json::ordered_json options;
+    options["verbose"]           = std::to_string(cfg->verbose());
+    options["stop-at"]           = cfg->stop_at();
+    options["print-timing-info"] = cfg->print_timing() ? "true" : "false";
     // Ignore stopAfter for now
-    // outputJson["program_options"]["stopAfter"] = cfg->stopAfterSec();
-    outputJson["program_options"]["heartbeat-period"]   = cfg->heartbeatPeriod();
-    outputJson["program_options"]["timebase"]           = cfg->timeBase();
-    outputJson["program_options"]["partitioner"]        = cfg->partitioner();
-    outputJson["program_options"]["timeVortex"]         = cfg->timeVortex();
-    outputJson["program_options"]["interthread-links"]  = cfg->interthread_links() ? "true" : "false";
-    outputJson["program_options"]["output-prefix-core"] = cfg->output_core_prefix();
+    // options["stopAfter"] = cfg->stopAfterSec();
+    options["heartbeat-period"]    = cfg->heartbeatPeriod();
+    options["timebase"]            = cfg->timeBase();
+    options["partitioner"]         = cfg->partitioner();
+    options["imbalance-tolerance"] = std::to_string(cfg->imbalance_tolerance());
+    options["timeVortex"]          = cfg->timeVortex();
+    options["interthread-links"]   = cfg->interthread_links() ? "true" : "false";
+    options["shared-memory-ranks"] = cfg->shared_memory_ranks() ? "true" : "false";
+    options["async-rank-sync"]     = cfg->async_rank_sync() ? "true" : "false";
+    options["per-peer-lookahead"]  = cfg->per_peer_lookahead() ? "true" : "false";
+    options["fifo-links"]          = cfg->fifo_links() ? "true" : "false";
+    options["untimed-quiescence"]  = cfg->untimed_quiescence() ? "true" : "false";
+    options["barrier-type"]        = cfg->barrier_type();
+    options["barrier-wait"]        = cfg->barrier_wait();
+    options["output-prefix-core"]  = cfg->output_core_prefix();
+
+    std::string out = "{\n  \"program_options\": ";
+    appendIndented(out, options.dump(2), "  ");
+    out.append(",\n");
 
     // Put in the global param sets
+    json::ordered_json global_params;
     for ( const auto& set : getGlobalParamSetNames() ) {
         for ( const auto& kvp : getGlobalParamSet(set) ) {
-            if ( kvp.first != "<set_name>" ) outputJson["global_params"][set][kvp.first] = kvp.second;
+            if ( kvp.first != "<set_name>" ) global_params[set][kvp.first] = kvp.second;
         }
     }
+    if ( !global_params.empty() ) {
+        out.append("  \"global_params\": ");
+        appendIndented(out, global_params.dump(2), "  ");
+        out.append(",\n");
+    }
 
-    // no components exist in this rank
-    if ( const_cast<ConfigComponentMap_t&>(compMap).size() == 0 ) { outputJson["components"]; }
+    out.append("  \"components\": [");
+    return out;
+}
 
-    for ( const auto& compItr : compMap ) {
-        outputJson["components"].emplace_back(CompWrapper { compItr, cfg->output_partition() });
+void
+JSONConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph)
+{
+    if ( shared ) {
+        generateShared(cfg, graph);
+        return;
     }
 
-    // no links exist in this rank
-    if ( const_cast<ConfigLinkMap_t&>(linkMap).size() == 0 ) { outputJson["links"]; }
+    if ( nullptr == outputFile ) { throw ConfigGraphOutputException("Output file is not open for writing"); }
+
+    const auto& compMap = graph->getComponentMap();
+    const auto& linkMap = graph->getLinkMap();
 
+    // Each element is written as soon as it is made, so the whole
+    // document is never held in memory
+    writeString(outputFile, documentStart(cfg));
+
+    std::string element;
+    uint64_t    count = 0;
+    for ( const auto& compItr : compMap ) {
+        element.clear();
+        appendElement(element, CompWrapper { compItr, cfg->output_partition() }, count++ == 0);
+        writeString(outputFile, element);
+    }
+    writeString(outputFile, arrayEnd(count) + ",\n  \"links\": [");
+
+    count = 0;
     for ( const auto& linkItr : linkMap ) {
-        outputJson["links"].push_back(LinkConfPair { linkItr, graph });
+        element.clear();
+        appendElement(element, LinkConfPair { linkItr, graph }, count++ == 0);
+        writeString(outputFile, element);
     }
+    writeString(outputFile, arrayEnd(count) + "\n}\n");
+}
 
-    std::stringstream ss;
-    ss << std::setw(2) << outputJson << std::endl;
+void
+JSONConfigGraphOutput::generateShared(const Config* cfg, ConfigGraph* graph)
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // Each rank writes its own components and the links that have an
+    // end on it.  Links between two ranks are written by the lower one.
+    std::vector<const ConfigComponent*> comps;
+    for ( const auto& comp : graph->getComponentMap() ) {
+        if ( comp->rank.rank == rank ) comps.push_back(comp);
+    }
+
+    std::vector<const ConfigLink*> links;
+    for ( const auto& link : graph->getLinkMap() ) {
+        uint32_t left  = graph->findComponent(link->component[0])->rank.rank;
+        uint32_t right = graph->findComponent(link->component[1])->rank.rank;
+        if ( std::min(left, right) == rank ) links.push_back(link);
+    }
+
+    // The ranks' parts follow each other in rank order.  The number of
+    // elements before this rank's tells whether it has the first one,
+    // which has no separator.
+    uint64_t counts[2] = { comps.size(), links.size() };
+    uint64_t counts_before[2];
+    uint64_t count_totals[2];
+    MPI_Exscan(counts, counts_before, 2, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(counts, count_totals, 2, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    if ( rank == 0 ) counts_before[0] = counts_before[1] = 0;
+
+    std::string comp_block;
+    for ( size_t i = 0; i < comps.size(); i++ ) {
+        appendElement(comp_block, CompWrapper { comps[i], cfg->output_partition() }, counts_before[0] + i == 0);
+    }
 
-    // Avoid lifetime issues, I don't think it's a big deal in this case due to
-    // lifetime extension, but this temp is the careful way.
-    std::string outputString = ss.str();
-    fprintf(outputFile, "%s", outputString.c_str());
+    std::string link_block;
+    for ( size_t i = 0; i < links.size(); i++ ) {
+        appendElement(link_block, LinkConfPair { links[i], graph }, counts_before[1] + i == 0);
+    }
+
+    // Then the sizes of the parts give the offsets to write them at
+    uint64_t sizes[2] = { comp_block.size(), link_block.size() };
+    uint64_t sizes_before[2];
+    uint64_t size_totals[2];
+    MPI_Exscan(sizes, sizes_before, 2, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(sizes, size_totals, 2, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    if ( rank == 0 ) sizes_before[0] = sizes_before[1] = 0;
+
+    std::string start;
+    if ( rank == 0 ) start = documentStart(cfg);
+    uint64_t start_size = start.size();
+    MPI_Bcast(&start_size, 1, MPI_UINT64_T, 0, MPI_COMM_WORLD);
+
+    const std::string middle = arrayEnd(count_totals[0]) + ",\n  \"links\": [";
+    const std::string end    = arrayEnd(count_totals[1]) + "\n}\n";
+
+    const uint64_t middle_offset = start_size + size_totals[0];
+    const uint64_t links_offset  = middle_offset + middle.size();
+    const uint64_t end_offset    = links_offset + size_totals[1];
+
+    MPI_File file;
+    if ( MPI_File_open(
+             MPI_COMM_WORLD, path.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file) != MPI_SUCCESS ) {
+        throw ConfigGraphOutputException("Unable to open output file for writing");
+    }
+    // Drop anything left from an older, longer file
+    MPI_File_set_size(file, 0);
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    // MPI counts are ints, so large blocks are written in pieces
+    auto write_at = [&file](uint64_t offset, const std::string& str) {
+        const uint64_t max_write = 1 << 30;
+        for ( uint64_t done = 0; done < str.size(); done += max_write ) {
+            int size = std::min(max_write, str.size() - done);
+            if ( MPI_File_write_at(file, offset + done, str.data() + done, size, MPI_CHAR, MPI_STATUS_IGNORE) !=
+                 MPI_SUCCESS ) {
+                throw ConfigGraphOutputException("Error writing JSON configuration graph");
+            }
+        }
+    };
+
+    if ( rank == 0 ) {
+        write_at(0, start);
+        write_at(middle_offset, middle);
+        write_at(end_offset, end);
+    }
+    write_at(start_size + sizes_before[0], comp_block);
+    write_at(links_offset + sizes_before[1], link_block);
+
+    MPI_File_close(&file);
+#else
+    (void)cfg;
+    (void)graph;
+#endif
 }
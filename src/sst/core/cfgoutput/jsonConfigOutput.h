@@ -16,6 +16,9 @@
 #include "sst/core/configGraph.h"
 #include "sst/core/configGraphOutput.h"
 
+#include <cstdint>
+#include <string>
+
 namespace SST {
 namespace Core {
 
@@ -24,7 +27,29 @@ class JSONConfigGraphOutput : public ConfigGraphOutput
 
 public:
     JSONConfigGraphOutput(const char* path);
+
+    /**
+     * Create an output where all the ranks write their part of the
+     * graph into the same file.  Must be created and generated on all
+     * ranks.
+     *
+     * @param path File to write to
+     * @param rank Rank this output is on
+     * @param num_ranks Number of ranks writing to the file
+     */
+    JSONConfigGraphOutput(const char* path, uint32_t rank, uint32_t num_ranks);
+
     virtual void generate(const Config* cfg, ConfigGraph* graph) override;
+
+private:
+    /** Everything in the document before the elements of the components array */
+    std::string documentStart(const Config* cfg);
+    void        generateShared(const Config* cfg, ConfigGraph* graph);
+
+    std::string path;
+    uint32_t    rank;
+    uint32_t    num_ranks;
+    bool        shared;
 };
 
 } // namespace Core
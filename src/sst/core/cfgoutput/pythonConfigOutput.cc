@@ -232,10 +232,25 @@ PythonConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph)
     fprintf(outputFile, "sst.setProgramOption(\"heartbeat-period\", \"%s\")\n", cfg->heartbeatPeriod().c_str());
     fprintf(outputFile, "sst.setProgramOption(\"timebase\", \"%s\")\n", cfg->timeBase().c_str());
     fprintf(outputFile, "sst.setProgramOption(\"partitioner\", \"%s\")\n", cfg->partitioner().c_str());
+    fprintf(outputFile, "sst.setProgramOption(\"imbalance-tolerance\", \"%g\")\n", cfg->imbalance_tolerance());
     fprintf(outputFile, "sst.setProgramOption(\"timeVortex\", \"%s\")\n", cfg->timeVortex().c_str());
     fprintf(
         outputFile, "sst.setProgramOption(\"interthread-links\", \"%s\")\n",
         cfg->interthread_links() ? "true" : "false");
+    fprintf(
+        outputFile, "sst.setProgramOption(\"shared-memory-ranks\", \"%s\")\n",
+        cfg->shared_memory_ranks() ? "true" : "false");
+    fprintf(
+        outputFile, "sst.setProgramOption(\"async-rank-sync\", \"%s\")\n", cfg->async_rank_sync() ? "true" : "false");
+    fprintf(
+        outputFile, "sst.setProgramOption(\"per-peer-lookahead\", \"%s\")\n",
+        cfg->per_peer_lookahead() ? "true" : "false");
+    fprintf(outputFile, "sst.setProgramOption(\"fifo-links\", \"%s\")\n", cfg->fifo_links() ? "true" : "false");
+    fprintf(
+        outputFile, "sst.setProgramOption(\"untimed-quiescence\", \"%s\")\n",
+        cfg->untimed_quiescence() ? "true" : "false");
+    fprintf(outputFile, "sst.setProgramOption(\"barrier-type\", \"%s\")\n", cfg->barrier_type().c_str());
+    fprintf(outputFile, "sst.setProgramOption(\"barrier-wait\", \"%s\")\n", cfg->barrier_wait().c_str());
     fprintf(outputFile, "sst.setProgramOption(\"output-prefix-core\", \"%s\")\n", cfg->output_core_prefix().c_str());
 
     // Output the global params
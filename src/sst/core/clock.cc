@@ -21,7 +21,13 @@
 
 namespace SST {
 
-Clock::Clock(TimeConverter* period, int priority) : Action(), currentCycle(0), period(period), scheduled(false)
+Clock::Clock(TimeConverter* period, int priority) :
+    Action(),
+    sim(Simulation_impl::getSimulation()),
+    currentCycle(0),
+    period(period),
+    numHandlers(0),
+    scheduled(false)
 {
     setPriority(priority);
 }
@@ -29,16 +35,33 @@ Clock::Clock(TimeConverter* period, int priority) : Action(), currentCycle(0), p
 Clock::~Clock()
 {
     // Delete all the handlers
-    for ( StaticHandlerMap_t::iterator it = staticHandlerMap.begin(); it != staticHandlerMap.end(); ++it ) {
-        delete *it;
+    for ( auto& group : handlerGroups ) {
+        for ( auto* handler : group.handlers ) {
+            delete handler;
+        }
     }
-    staticHandlerMap.clear();
+    handlerGroups.clear();
+    handlerLocations.clear();
 }
 
 bool
 Clock::registerHandler(Clock::HandlerBase* handler)
 {
-    staticHandlerMap.push_back(handler);
+    std::type_index type(typeid(*handler));
+
+    uint32_t group = 0;
+    while ( group < handlerGroups.size() && handlerGroups[group].type != type ) {
+        group++;
+    }
+    if ( group == handlerGroups.size() ) handlerGroups.emplace_back(type);
+
+    auto& handlers = handlerGroups[group].handlers;
+    // If the handler is registered more than once, this finds the
+    // latest one
+    handlerLocations[handler] = HandlerLocation_t(group, handlers.size());
+    handlers.push_back(handler);
+    numHandlers++;
+
     if ( !scheduled ) { schedule(); }
     return 0;
 }
@@ -46,21 +69,66 @@ Clock::registerHandler(Clock::HandlerBase* handler)
 bool
 Clock::unregisterHandler(Clock::HandlerBase* handler, bool& empty)
 {
-
-    StaticHandlerMap_t::iterator iter = staticHandlerMap.begin();
-
-    for ( ; iter != staticHandlerMap.end(); iter++ ) {
-        if ( *iter == handler ) {
-            staticHandlerMap.erase(iter);
-            break;
+    auto it = handlerLocations.find(handler);
+    if ( it != handlerLocations.end() ) {
+        removeHandler(it->second.first, it->second.second);
+    }
+    else {
+        // Only happens for a handler that was registered more than
+        // once and has already been removed once
+        bool found = false;
+        for ( uint32_t group = 0; group < handlerGroups.size() && !found; group++ ) {
+            auto& handlers = handlerGroups[group].handlers;
+            for ( uint32_t index = 0; index < handlers.size(); index++ ) {
+                if ( handlers[index] == handler ) {
+                    removeHandler(group, index);
+                    found = true;
+                    break;
+                }
+            }
         }
     }
 
-    empty = staticHandlerMap.empty();
+    empty = (numHandlers == 0);
 
     return 0;
 }
 
+void
+Clock::removeHandler(uint32_t group, uint32_t index)
+{
+    HandlerGroup&       hg      = handlerGroups[group];
+    Clock::HandlerBase* handler = hg.handlers[index];
+
+    auto it = handlerLocations.find(handler);
+    if ( it != handlerLocations.end() && it->second == HandlerLocation_t(group, index) ) handlerLocations.erase(it);
+
+    hg.handlers[index] = nullptr;
+    hg.removed++;
+    numHandlers--;
+}
+
+void
+Clock::compactGroup(uint32_t group)
+{
+    HandlerGroup& hg   = handlerGroups[group];
+    uint32_t      dest = 0;
+    for ( uint32_t index = 0; index < hg.handlers.size(); index++ ) {
+        Clock::HandlerBase* handler = hg.handlers[index];
+        if ( handler == nullptr ) continue;
+        if ( dest != index ) {
+            auto it = handlerLocations.find(handler);
+            if ( it != handlerLocations.end() && it->second == HandlerLocation_t(group, index) ) {
+                it->second.second = dest;
+            }
+            hg.handlers[dest] = handler;
+        }
+        dest++;
+    }
+    hg.handlers.resize(dest);
+    hg.removed = 0;
+}
+
 Cycle_t
 Clock::getNextCycle()
 {
@@ -72,9 +140,7 @@ Clock::getNextCycle()
 void
 Clock::execute(void)
 {
-    Simulation_impl* sim = Simulation_impl::getSimulation();
-
-    if ( staticHandlerMap.empty() ) {
+    if ( numHandlers == 0 ) {
         scheduled = false;
         return;
     }
@@ -83,18 +149,25 @@ Clock::execute(void)
     // currentCycle = period->convertFromCoreTime(sim->getCurrentSimCycle());
     currentCycle++;
 
-    StaticHandlerMap_t::iterator sop_iter;
-    for ( sop_iter = staticHandlerMap.begin(); sop_iter != staticHandlerMap.end(); ) {
-        Clock::HandlerBase* handler = *sop_iter;
-
-
-        if ( (*handler)(currentCycle) )
-            sop_iter = staticHandlerMap.erase(sop_iter);
-        else
-            ++sop_iter;
+    // Handlers can register and unregister handlers, so only use
+    // indices here.  Anything added during the tick is past the end.
+    const uint32_t num_groups = handlerGroups.size();
+    for ( uint32_t group = 0; group < num_groups; group++ ) {
+        const uint32_t num = handlerGroups[group].handlers.size();
+        for ( uint32_t index = 0; index < num; index++ ) {
+            Clock::HandlerBase* handler = handlerGroups[group].handlers[index];
+            if ( handler == nullptr ) continue;
+
+            if ( (*handler)(currentCycle) ) {
+                // The handler may have removed itself already
+                if ( handlerGroups[group].handlers[index] == handler ) removeHandler(group, index);
+            }
+        }
+    }
 
-        // (*handler)(currentCycle);
-        // ++sop_iter;
+    // Drop the removed handlers once they make up a quarter of a group
+    for ( uint32_t group = 0; group < handlerGroups.size(); group++ ) {
+        if ( handlerGroups[group].removed * 4 > handlerGroups[group].handlers.size() ) compactGroup(group);
     }
 
     next = sim->getCurrentSimCycle() + period->getFactor();
@@ -106,9 +179,8 @@ Clock::execute(void)
 void
 Clock::schedule()
 {
-    Simulation_impl* sim = Simulation_impl::getSimulation();
-    currentCycle         = sim->getCurrentSimCycle() / period->getFactor();
-    SimTime_t next       = (currentCycle * period->getFactor()) + period->getFactor();
+    currentCycle   = sim->getCurrentSimCycle() / period->getFactor();
+    SimTime_t next = (currentCycle * period->getFactor()) + period->getFactor();
 
     // Check to see if we need to insert clock into queue at current
     // simtime.  This happens if the clock would have fired at this
@@ -128,8 +200,7 @@ Clock::schedule()
 void
 Clock::updateCurrentCycle()
 {
-    Simulation_impl* sim = Simulation_impl::getSimulation();
-    currentCycle         = sim->getCurrentSimCycle() / period->getFactor();
+    currentCycle = sim->getCurrentSimCycle() / period->getFactor();
     return;
 }
 
@@ -138,7 +209,7 @@ Clock::toString() const
 {
     std::stringstream buf;
     buf << "Clock Activity with period " << period->getFactor() << " to be delivered at " << getDeliveryTime()
-        << " with priority " << getPriority() << " with " << staticHandlerMap.size() << " items on clock list";
+        << " with priority " << getPriority() << " with " << numHandlers << " items on clock list";
     return buf.str();
 }
 
@@ -16,18 +16,26 @@
 #include "sst/core/ssthandler.h"
 
 #include <cinttypes>
+#include <typeindex>
+#include <unordered_map>
 #include <vector>
 
 #define _CLE_DBG(fmt, args...) __DBG(DBG_CLOCK, Clock, fmt, ##args)
 
 namespace SST {
 
+class Simulation_impl;
 class TimeConverter;
 
 /**
  * A Clock class.
  *
- * Calls callback functions (handlers) on a specified period
+ * Calls callback functions (handlers) on a specified period.
+ * Handlers of the same type are kept together and called one after
+ * the other, in the order they were registered, so a clock shared by
+ * many instances of a component makes the same indirect call over
+ * and over.  Removed handlers are marked and dropped from their list
+ * after a tick, so unregistering is constant time.
  */
 class Clock : public Action
 {
@@ -83,7 +91,8 @@ public:
      */
     void updateCurrentCycle();
 
-    /** Add a handler to be called on this clock's tick */
+    /** Add a handler to be called on this clock's tick.  Handlers
+     * added during a tick are first called on the next one. */
     bool registerHandler(Clock::HandlerBase* handler);
     /** Remove a handler from the list of handlers to be called on the clock tick */
     bool unregisterHandler(Clock::HandlerBase* handler, bool& empty);
@@ -91,18 +100,36 @@ public:
     std::string toString() const override;
 
 private:
-    /*     typedef std::list<Clock::HandlerBase*> HandlerMap_t; */
-    typedef std::vector<Clock::HandlerBase*> StaticHandlerMap_t;
+    // Handlers that all have the same type.  nullptr marks a handler
+    // that was removed.
+    struct HandlerGroup
+    {
+        std::type_index                  type;
+        std::vector<Clock::HandlerBase*> handlers;
+        size_t                           removed;
+
+        HandlerGroup(std::type_index type) : type(type), removed(0) {}
+    };
+
+    // Group and index of a handler
+    typedef std::pair<uint32_t, uint32_t> HandlerLocation_t;
 
     Clock() {}
 
     void execute(void) override;
 
-    Cycle_t            currentCycle;
-    TimeConverter*     period;
-    StaticHandlerMap_t staticHandlerMap;
-    SimTime_t          next;
-    bool               scheduled;
+    void removeHandler(uint32_t group, uint32_t index);
+    void compactGroup(uint32_t group);
+
+    // Simulation for the thread that owns this clock
+    Simulation_impl*                                           sim;
+    Cycle_t                                                    currentCycle;
+    TimeConverter*                                             period;
+    std::vector<HandlerGroup>                                  handlerGroups;
+    std::unordered_map<Clock::HandlerBase*, HandlerLocation_t> handlerLocations;
+    size_t                                                     numHandlers;
+    SimTime_t                                                  next;
+    bool                                                       scheduled;
 
     NotSerializable(SST::Clock)
 };
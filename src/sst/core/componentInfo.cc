@@ -33,6 +33,7 @@ ComponentInfo::ComponentInfo(ComponentId_t id, const std::string& name) :
     allStatConfig(nullptr),
     coordinates(3, 0.0),
     subIDIndex(1),
+    untimed_pending(nullptr),
     slot_name(""),
     slot_num(-1),
     share_flags(0)
@@ -74,6 +75,7 @@ ComponentInfo::ComponentInfo(
     statLoadLevel(0),
     coordinates(parent_info->coordinates),
     subIDIndex(1),
+    untimed_pending(nullptr),
     slot_name(slot_name),
     slot_num(slot_num),
     share_flags(share_flags)
@@ -98,6 +100,7 @@ ComponentInfo::ComponentInfo(
     statLoadLevel(ccomp->statLoadLevel),
     coordinates(ccomp->coords),
     subIDIndex(1),
+    untimed_pending(nullptr),
     slot_name(ccomp->name),
     slot_num(ccomp->slot_num),
     share_flags(0)
@@ -142,6 +145,7 @@ ComponentInfo::ComponentInfo(ComponentInfo&& o) :
     statLoadLevel(o.statLoadLevel),
     coordinates(o.coordinates),
     subIDIndex(o.subIDIndex),
+    untimed_pending(o.untimed_pending),
     slot_name(o.slot_name),
     slot_num(o.slot_num),
     share_flags(o.share_flags)
@@ -217,6 +221,19 @@ ComponentInfo::prepareForComplete() const
     }
 }
 
+void
+ComponentInfo::watchUntimedData(bool* pending) const
+{
+    if ( nullptr != link_map ) {
+        for ( auto& i : link_map->getLinkMap() ) {
+            i.second->untimed_pending = pending;
+        }
+    }
+    for ( auto& s : subComponents ) {
+        s.second.watchUntimedData(pending);
+    }
+}
+
 ComponentInfo*
 ComponentInfo::findSubComponent(ComponentId_t id)
 {
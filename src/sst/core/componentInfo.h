@@ -13,6 +13,7 @@
 #define SST_CORE_COMPONENTINFO_H
 
 #include "sst/core/params.h"
+#include "sst/core/sparseVectorMap.h"
 #include "sst/core/sst_types.h"
 
 #include <functional>
@@ -110,10 +111,10 @@ private:
 
     TimeConverter* defaultTimeBase;
 
-    std::map<StatisticId_t, ConfigStatistic>* statConfigs;
-    std::map<std::string, StatisticId_t>*     enabledStatNames;
-    bool                                      enabledAllStats;
-    const ConfigStatistic*                    allStatConfig;
+    SparseVectorMap<StatisticId_t, ConfigStatistic>* statConfigs;
+    std::map<std::string, StatisticId_t>*            enabledStatNames;
+    bool                                             enabledAllStats;
+    const ConfigStatistic*                           allStatConfig;
 
     uint8_t statLoadLevel;
 
@@ -121,6 +122,14 @@ private:
 
     uint64_t subIDIndex;
 
+    /**
+       Flags that are set when the Component has untimed data waiting
+       for it, or asked to be called, in an untimed phase.  Indexed by
+       the parity of the phase.  Only set for Components, and only
+       with --untimed-quiescence.
+     */
+    bool* untimed_pending;
+
     // Variables only used by SubComponents
 
     /**
@@ -155,6 +164,9 @@ private:
     ComponentInfo(ComponentId_t id, const std::string& name);
     void finalizeLinkConfiguration() const;
     void prepareForComplete() const;
+    /* Have the links of this (Sub)Component and its SubComponents set
+       pending when untimed data is sent to them */
+    void watchUntimedData(bool* pending) const;
 
     ComponentId_t addAnonymousSubComponent(
         ComponentInfo* parent_info, const std::string& type, const std::string& slot_name, int slot_num,
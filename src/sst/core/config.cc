@@ -158,6 +158,24 @@ public:
         return 0;
     }
 
+    // partitioner imbalance tolerance
+    static int setImbalanceTolerance(Config* cfg, const std::string& arg)
+    {
+        try {
+            double val = stod(arg);
+            if ( val < 0.0 ) {
+                fprintf(stderr, "Option --imbalance-tolerance must not be negative: '%s'\n", arg.c_str());
+                return -1;
+            }
+            cfg->imbalance_tolerance_ = val;
+            return 0;
+        }
+        catch ( std::invalid_argument& e ) {
+            fprintf(stderr, "Failed to parse '%s' as number for option --imbalance-tolerance\n", arg.c_str());
+            return -1;
+        }
+    }
+
     // heart beat
     static int setHeartbeat(Config* cfg, const std::string& arg)
     {
@@ -197,6 +215,13 @@ public:
         return 0;
     }
 
+    // output config binary
+    static int setWriteBinary(Config* cfg, const std::string& arg)
+    {
+        cfg->output_binary_ = arg;
+        return 0;
+    }
+
     // parallel output
 #ifdef SST_CONFIG_HAVE_MPI
     static int enableParallelOutput(Config* cfg, const std::string& arg)
@@ -206,11 +231,23 @@ public:
 
         bool state = true;
         // If there's an arg, we need to parse it.  Otherwise, it will
-        // just get set to true.
+        // just get set to true.  SINGLE and MULTI also turn it on and
+        // pick whether the ranks write one file or a file each.
         if ( arg != "" ) {
-            bool success;
-            state = cfg->parseBoolean(arg, success, "parallel-output");
-            if ( !success ) return -1;
+            std::string arg_lower(arg);
+            std::locale loc;
+            for ( auto& ch : arg_lower )
+                ch = std::tolower(ch, loc);
+
+            if ( arg_lower == "single" ) { cfg->parallel_output_mode_multi_ = false; }
+            else if ( arg_lower == "multi" ) {
+                cfg->parallel_output_mode_multi_ = true;
+            }
+            else {
+                bool success;
+                state = cfg->parseBoolean(arg, success, "parallel-output");
+                if ( !success ) return -1;
+            }
         }
 
         cfg->parallel_output_ = state;
@@ -327,6 +364,120 @@ public:
         return success ? 0 : -1;
     }
 
+    // thread barrier type
+    static int setBarrierType(Config* cfg, const std::string& arg)
+    {
+        std::string arg_lower(arg);
+        std::locale loc;
+        for ( auto& ch : arg_lower )
+            ch = std::tolower(ch, loc);
+
+        if ( arg_lower != "central" && arg_lower != "tree" ) {
+            fprintf(
+                stderr, "Invalid option '%s' passed to --barrier-type.  Valid options are CENTRAL and TREE.\n",
+                arg.c_str());
+            return -1;
+        }
+        cfg->barrier_type_ = arg_lower;
+        return 0;
+    }
+
+    // thread barrier wait policy
+    static int setBarrierWait(Config* cfg, const std::string& arg)
+    {
+        std::string arg_lower(arg);
+        std::locale loc;
+        for ( auto& ch : arg_lower )
+            ch = std::tolower(ch, loc);
+
+        if ( arg_lower != "spin" && arg_lower != "yield" && arg_lower != "sleep" && arg_lower != "block" ) {
+            fprintf(
+                stderr,
+                "Invalid option '%s' passed to --barrier-wait.  Valid options are SPIN, YIELD, SLEEP and BLOCK.\n",
+                arg.c_str());
+            return -1;
+        }
+        cfg->barrier_wait_ = arg_lower;
+        return 0;
+    }
+
+    // shared memory rank sync
+    static int setSharedMemoryRanks(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->shared_memory_ranks_ = true;
+            return checkRankSyncConflict(cfg);
+        }
+
+        bool success              = false;
+        cfg->shared_memory_ranks_ = cfg->parseBoolean(arg, success, "shared-memory-ranks");
+        return success ? checkRankSyncConflict(cfg) : -1;
+    }
+
+    // asynchronous rank sync
+    static int setAsyncRankSync(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->async_rank_sync_ = true;
+            return 0;
+        }
+
+        bool success          = false;
+        cfg->async_rank_sync_ = cfg->parseBoolean(arg, success, "async-rank-sync");
+        return success ? 0 : -1;
+    }
+
+    // same thread link FIFOs
+    static int setFifoLinks(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->fifo_links_ = true;
+            return 0;
+        }
+
+        bool success     = false;
+        cfg->fifo_links_ = cfg->parseBoolean(arg, success, "fifo-links");
+        return success ? 0 : -1;
+    }
+
+    // untimed phases only call components with work
+    static int setUntimedQuiescence(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->untimed_quiescence_ = true;
+            return 0;
+        }
+
+        bool success             = false;
+        cfg->untimed_quiescence_ = cfg->parseBoolean(arg, success, "untimed-quiescence");
+        return success ? 0 : -1;
+    }
+
+    // per peer lookahead for rank sync
+    static int setPerPeerLookahead(Config* cfg, const std::string& arg)
+    {
+        if ( arg == "" ) {
+            cfg->per_peer_lookahead_ = true;
+            return checkRankSyncConflict(cfg);
+        }
+
+        bool success             = false;
+        cfg->per_peer_lookahead_ = cfg->parseBoolean(arg, success, "per-peer-lookahead");
+        return success ? checkRankSyncConflict(cfg) : -1;
+    }
+
+    // The shared memory and per peer rank syncs are separate
+    // implementations, so only one of them can be selected.  Options
+    // set from the model are checked again in main().
+    static int checkRankSyncConflict(Config* cfg)
+    {
+        if ( cfg->shared_memory_ranks_ && cfg->per_peer_lookahead_ ) {
+            fprintf(stderr, "ERROR: --shared-memory-ranks and --per-peer-lookahead cannot be used together\n");
+            return -1;
+        }
+        return 0;
+    }
+
 #ifdef USE_MEMPOOL
     // cache align mempool allocations
     static int setCacheAlignMempools(Config* cfg, const std::string& arg)
@@ -362,6 +513,18 @@ public:
         return 0;
     }
 
+    static int setOutputComponentWeights(Config* cfg, const std::string& arg)
+    {
+        cfg->output_component_weights_ = arg;
+        return 0;
+    }
+
+    static int setComponentWeights(Config* cfg, const std::string& arg)
+    {
+        cfg->component_weights_ = arg;
+        return 0;
+    }
+
     static std::string getTimebaseExtHelp()
     {
         std::string msg = "Timebase:\n\n";
@@ -477,12 +640,15 @@ Config::print()
     std::cout << "stop_at = " << stop_at_ << std::endl;
     std::cout << "exit_after = " << exit_after_ << std::endl;
     std::cout << "partitioner = " << partitioner_ << std::endl;
+    std::cout << "imbalance_tolerance = " << imbalance_tolerance_ << std::endl;
     std::cout << "heartbeatPeriod = " << heartbeatPeriod_ << std::endl;
     std::cout << "output_directory = " << output_directory_ << std::endl;
     std::cout << "output_core_prefix = " << output_core_prefix_ << std::endl;
     std::cout << "output_config_graph = " << output_config_graph_ << std::endl;
     std::cout << "output_json = " << output_json_ << std::endl;
+    std::cout << "output_binary = " << output_binary_ << std::endl;
     std::cout << "parallel_output = " << parallel_output_ << std::endl;
+    std::cout << "parallel_output_mode_multi = " << parallel_output_mode_multi_ << std::endl;
     std::cout << "output_dot = " << output_dot_ << std::endl;
     std::cout << "dot_verbosity = " << dot_verbosity_ << std::endl;
     std::cout << "component_partition_file = " << component_partition_file_ << std::endl;
@@ -491,6 +657,13 @@ Config::print()
     std::cout << "parallel_load = " << parallel_load_ << std::endl;
     std::cout << "timeVortex = " << timeVortex_ << std::endl;
     std::cout << "interthread_links = " << interthread_links_ << std::endl;
+    std::cout << "shared_memory_ranks = " << shared_memory_ranks_ << std::endl;
+    std::cout << "async_rank_sync = " << async_rank_sync_ << std::endl;
+    std::cout << "per_peer_lookahead = " << per_peer_lookahead_ << std::endl;
+    std::cout << "fifo_links = " << fifo_links_ << std::endl;
+    std::cout << "untimed_quiescence = " << untimed_quiescence_ << std::endl;
+    std::cout << "barrier_type = " << barrier_type_ << std::endl;
+    std::cout << "barrier_wait = " << barrier_wait_ << std::endl;
 #ifdef USE_MEMPOOL
     std::cout << "cache_align_mempools = " << cache_align_mempools_ << std::endl;
 #endif
@@ -499,6 +672,8 @@ Config::print()
     std::cout << "addLlibPath = " << addlibpath_ << std::endl;
     std::cout << "enabled_profiling = " << enabled_profiling_ << std::endl;
     std::cout << "profiling_output = " << profiling_output_ << std::endl;
+    std::cout << "output_component_weights = " << output_component_weights_ << std::endl;
+    std::cout << "component_weights = " << component_weights_ << std::endl;
 
     switch ( runMode_ ) {
     case SimulationRunMode::INIT:
@@ -535,15 +710,16 @@ Config::Config(uint32_t num_ranks, bool first_rank) : ConfigShared(!first_rank,
     // Basic Options
     first_rank_ = first_rank;
 
-    num_ranks_       = num_ranks;
-    num_threads_     = 1;
-    configFile_      = "NONE";
-    model_options_   = "";
-    print_timing_    = false;
-    stop_at_         = "0 ns";
-    exit_after_      = 0;
-    partitioner_     = "sst.linear";
-    heartbeatPeriod_ = "";
+    num_ranks_           = num_ranks;
+    num_threads_         = 1;
+    configFile_          = "NONE";
+    model_options_       = "";
+    print_timing_        = false;
+    stop_at_             = "0 ns";
+    exit_after_          = 0;
+    partitioner_         = "sst.linear";
+    imbalance_tolerance_ = 0.05;
+    heartbeatPeriod_     = "";
 
     char* wd_buf = (char*)malloc(sizeof(char) * PATH_MAX);
     getcwd(wd_buf, PATH_MAX);
@@ -560,7 +736,9 @@ Config::Config(uint32_t num_ranks, bool first_rank) : ConfigShared(!first_rank,
 
     output_config_graph_ = "";
     output_json_         = "";
-    parallel_output_     = false;
+    output_binary_       = "";
+    parallel_output_            = false;
+    parallel_output_mode_multi_ = true;
 
     // Graph output
     output_dot_               = "";
@@ -574,14 +752,23 @@ Config::Config(uint32_t num_ranks, bool first_rank) : ConfigShared(!first_rank,
     parallel_load_mode_multi_ = true;
     timeVortex_               = "sst.timevortex.priority_queue";
     interthread_links_        = false;
+    shared_memory_ranks_      = false;
+    async_rank_sync_          = false;
+    per_peer_lookahead_       = false;
+    fifo_links_               = false;
+    untimed_quiescence_       = false;
+    barrier_type_             = "central";
+    barrier_wait_             = "sleep";
 #ifdef USE_MEMPOOL
     cache_align_mempools_ = false;
 #endif
     debugFile_ = "/dev/null";
 
     // Advance Options - Profiling
-    enabled_profiling_ = "";
-    profiling_output_  = "stdout";
+    enabled_profiling_        = "";
+    profiling_output_         = "stdout";
+    output_component_weights_ = "";
+    component_weights_        = "";
 
     // Advanced Options - Debug
     runMode_ = SimulationRunMode::BOTH;
@@ -670,6 +857,12 @@ Config::insertOptions()
     DEF_ARG(
         "partitioner", 0, "PARTITIONER", "Select the partitioner to be used. <lib.partitionerName>",
         std::bind(&ConfigHelper::setPartitioner, this, _1), true);
+    DEF_ARG(
+        "imbalance-tolerance", 0, "FRAC",
+        "Set how much heavier than the average the heaviest rank may be made by a partitioner that trades balance for "
+        "a better cut, as a fraction of the average [0.05 (default)].  Used by sst.latency and sst.labelprop, and by "
+        "sst.multilevel for each side of every bisection",
+        std::bind(&ConfigHelper::setImbalanceTolerance, this, _1), true);
     DEF_ARG(
         "heartbeat-period", 0, "PERIOD",
         "Set time for heartbeats to be published (these are approximate timings, published by the core, to update on "
@@ -691,12 +884,20 @@ Config::insertOptions()
     DEF_ARG(
         "output-json", 0, "FILE", "File to write SST configuration graph (in JSON format)",
         std::bind(&ConfigHelper::setWriteJSON, this, _1), true);
+    DEF_ARG(
+        "output-binary", 0, "FILE",
+        "File to write SST configuration graph (in binary format, split into per-rank sections that can be loaded in "
+        "parallel)",
+        std::bind(&ConfigHelper::setWriteBinary, this, _1), true);
 #ifdef SST_CONFIG_HAVE_MPI
-    DEF_FLAG_OPTVAL(
-        "parallel-output", 0,
+    DEF_ARG_OPTVAL(
+        "parallel-output", 0, "MODE",
         "Enable parallel output of configuration information.  This option is ignored for single rank jobs.  Must also "
-        "specify an output type (--output-config "
-        "and/or --output-json).  Note: this will also cause partition info to be output if set to true.",
+        "specify an output type (--output-config, "
+        "--output-json and/or --output-binary).  Optional mode parameters are a boolean, SINGLE and MULTI (default).  "
+        "If MULTI is specified, each rank writes its own file.  If SINGLE is specified, the ranks write their parts of "
+        "the graph into one file; only JSON output supports this, the other formats still write a file per rank.  "
+        "Note: this will also cause partition info to be output if set to true.",
         std::bind(&ConfigHelper::enableParallelOutput, this, _1), true);
 #endif
 
@@ -735,6 +936,43 @@ Config::insertOptions()
     DEF_FLAG_OPTVAL(
         "interthread-links", 0, "[EXPERIMENTAL] Set whether or not interthread links should be used",
         std::bind(&ConfigHelper::setInterThreadLinks, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "shared-memory-ranks", 0,
+        "[EXPERIMENTAL] Set whether events sent to ranks on the same node should be exchanged through shared memory "
+        "instead of MPI.  Cannot be used with --per-peer-lookahead",
+        std::bind(&ConfigHelper::setSharedMemoryRanks, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "async-rank-sync", 0,
+        "[EXPERIMENTAL] Set whether the rank sync should overlap its communication with event processing.  Ignored "
+        "when --shared-memory-ranks is set",
+        std::bind(&ConfigHelper::setAsyncRankSync, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "per-peer-lookahead", 0,
+        "[EXPERIMENTAL] Set whether each pair of ranks should sync based on the latency of the links between them "
+        "instead of the minimum partition latency.  Only used with one thread per rank.  Cannot be used with "
+        "--shared-memory-ranks",
+        std::bind(&ConfigHelper::setPerPeerLookahead, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "fifo-links", 0,
+        "[EXPERIMENTAL] Set whether events sent with no extra delay on links within a thread should be queued in "
+        "per-timestamp FIFOs instead of the TimeVortex.  Events are delivered in the same order either way",
+        std::bind(&ConfigHelper::setFifoLinks, this, _1), true);
+    DEF_FLAG_OPTVAL(
+        "untimed-quiescence", 0,
+        "[EXPERIMENTAL] Set whether init() and complete() should only be called in a phase on components that "
+        "received untimed data or called requestUntimedPhase() in the previous phase.  All components are called "
+        "in phase 0",
+        std::bind(&ConfigHelper::setUntimedQuiescence, this, _1), true);
+    DEF_ARG(
+        "barrier-type", 0, "TYPE",
+        "[EXPERIMENTAL] Set the type of barrier used between threads.  CENTRAL (default) uses a single shared counter.  "
+        "TREE uses a combining tree of counters to reduce contention with many threads",
+        std::bind(&ConfigHelper::setBarrierType, this, _1), true);
+    DEF_ARG(
+        "barrier-wait", 0, "POLICY",
+        "[EXPERIMENTAL] Set how threads wait at barriers.  SPIN busy waits, YIELD spins then yields the core, SLEEP "
+        "(default) spins, yields, then sleeps in short intervals and BLOCK spins, yields, then blocks until released",
+        std::bind(&ConfigHelper::setBarrierWait, this, _1), true);
 #ifdef USE_MEMPOOL
     DEF_FLAG_OPTVAL(
         "cache-align-mempools", 0, "[EXPERIMENTAL] Set whether mempool allocations are cache aligned",
@@ -755,6 +993,17 @@ Config::insertOptions()
     DEF_ARG(
         "profiling-output", 0, "FILE", "Set output location for profiling data [stdout (default) or a filename]",
         std::bind(&ConfigHelper::setProfilingOutput, this, _1), true);
+    DEF_ARG(
+        "output-component-weights", 0, "FILE",
+        "Time the clock and event handlers of each component and write the times to FILE at the end of simulation, "
+        "along with the load imbalance across ranks and threads.  The file can be passed to --component-weights to "
+        "rebalance the next run",
+        std::bind(&ConfigHelper::setOutputComponentWeights, this, _1), true);
+    DEF_ARG(
+        "component-weights", 0, "FILE",
+        "Set the weight used by the partitioner for each component listed in FILE, as written by "
+        "--output-component-weights",
+        std::bind(&ConfigHelper::setComponentWeights, this, _1), true);
 
     /* Advanced Features - Debug */
     DEF_SECTION_HEADING("Advanced Options - Debug");
@@ -840,6 +1089,10 @@ Config::checkArgsAfterParsing()
 
     if ( output_json_.size() > 0 && isFileNameOnly(output_json_) ) { output_json_.insert(0, output_directory_); }
 
+    if ( output_binary_.size() > 0 && isFileNameOnly(output_binary_) ) {
+        output_binary_.insert(0, output_directory_);
+    }
+
     if ( debugFile_.size() > 0 && isFileNameOnly(debugFile_) ) { debugFile_.insert(0, output_directory_); }
     return 0;
 }
@@ -131,6 +131,13 @@ public:
     */
     const std::string& partitioner() const { return partitioner_; }
 
+    /**
+       Fraction of the average rank load that the heaviest rank may
+       exceed it by, for partitioners that trade balance for a better
+       cut.  Defaults to 0.05.
+    */
+    double imbalance_tolerance() const { return imbalance_tolerance_; }
+
     /**
        Simulation period at which to print out a "heartbeat" message
     */
@@ -160,12 +167,25 @@ public:
     */
     const std::string& output_json() const { return output_json_; }
 
+    /**
+       File to output binary formatted config graph to (empty string
+       means no output)
+    */
+    const std::string& output_binary() const { return output_binary_; }
+
     /**
        If true, and a config graph output option is specified, write
        each ranks graph separately
     */
     bool parallel_output() const { return parallel_output_; }
 
+    /**
+       If parallel output is on, write a file per rank if true, and
+       one file shared by all the ranks if false.  Only JSON output
+       can be written to a shared file.
+    */
+    bool parallel_output_mode_multi() const { return parallel_output_mode_multi_; }
+
 
     // Graph output
 
@@ -236,6 +256,45 @@ public:
     */
     bool interthread_links() const { return interthread_links_; }
 
+    /**
+       Exchange events with ranks on the same node through shared
+       memory
+    */
+    bool shared_memory_ranks() const { return shared_memory_ranks_; }
+
+    /**
+       Overlap the rank sync communication with event processing
+    */
+    bool async_rank_sync() const { return async_rank_sync_; }
+
+    /**
+       Sync each pair of ranks based on the latency of the links
+       between them
+    */
+    bool per_peer_lookahead() const { return per_peer_lookahead_; }
+
+    /**
+       Queue events sent with no extra delay on links within a thread
+       in per-timestamp FIFOs instead of the TimeVortex
+    */
+    bool fifo_links() const { return fifo_links_; }
+
+    /**
+       Only call init() and complete() in a phase on components that
+       received untimed data or asked to be called again
+    */
+    bool untimed_quiescence() const { return untimed_quiescence_; }
+
+    /**
+       Type of barrier used between threads (central or tree)
+    */
+    const std::string& barrier_type() const { return barrier_type_; }
+
+    /**
+       How threads wait at barriers (spin, yield, sleep or block)
+    */
+    const std::string& barrier_wait() const { return barrier_wait_; }
+
 #ifdef USE_MEMPOOL
     /**
        Controls whether mempool items are cache-aligned
@@ -276,6 +335,16 @@ public:
      */
     const std::string& profilingOutput() const { return profiling_output_; }
 
+    /**
+       File to write the measured cost of each component to
+     */
+    const std::string& outputComponentWeights() const { return output_component_weights_; }
+
+    /**
+       File to read the component weights used for partitioning from
+     */
+    const std::string& componentWeights() const { return component_weights_; }
+
     // Advanced options - Debug
 
     /**
@@ -360,13 +429,16 @@ public:
         ser& stop_at_;
         ser& exit_after_;
         ser& partitioner_;
+        ser& imbalance_tolerance_;
         ser& heartbeatPeriod_;
         ser& output_directory_;
         ser& output_core_prefix_;
 
         ser& output_config_graph_;
         ser& output_json_;
+        ser& output_binary_;
         ser& parallel_output_;
+        ser& parallel_output_mode_multi_;
 
         ser& output_dot_;
         ser& dot_verbosity_;
@@ -378,6 +450,13 @@ public:
         ser& parallel_load_mode_multi_;
         ser& timeVortex_;
         ser& interthread_links_;
+        ser& shared_memory_ranks_;
+        ser& async_rank_sync_;
+        ser& per_peer_lookahead_;
+        ser& fifo_links_;
+        ser& untimed_quiescence_;
+        ser& barrier_type_;
+        ser& barrier_wait_;
 #ifdef USE_MEMPOOL
         ser& cache_align_mempools_;
 #endif
@@ -386,6 +465,8 @@ public:
         ser& addlibpath_;
         ser& enabled_profiling_;
         ser& profiling_output_;
+        ser& output_component_weights_;
+        ser& component_weights_;
         ser& runMode_;
 #ifdef USE_MEMPOOL
         ser& event_dump_file_;
@@ -436,22 +517,25 @@ private:
     // Basic options
     // uint32_t    verbose_; ** in ConfigShared
     // Num threads held in RankInfo.thread
-    uint32_t    num_ranks_;          /*!< Number of ranks in the simulation */
-    uint32_t    num_threads_;        /*!< Number of threads requested */
-    std::string configFile_;         /*!< Graph generation file */
-    std::string model_options_;      /*!< Options to pass to Python Model generator */
-    bool        print_timing_;       /*!< Print SST timing information */
-    std::string stop_at_;            /*!< When to stop the simulation */
-    uint32_t    exit_after_;         /*!< When (wall-time) to stop the simulation */
-    std::string partitioner_;        /*!< Partitioner to use */
-    std::string heartbeatPeriod_;    /*!< Sets the heartbeat period for the simulation */
-    std::string output_directory_;   /*!< Output directory to dump all files to */
-    std::string output_core_prefix_; /*!< Set the SST::Output prefix for the core */
+    uint32_t    num_ranks_;           /*!< Number of ranks in the simulation */
+    uint32_t    num_threads_;         /*!< Number of threads requested */
+    std::string configFile_;          /*!< Graph generation file */
+    std::string model_options_;       /*!< Options to pass to Python Model generator */
+    bool        print_timing_;        /*!< Print SST timing information */
+    std::string stop_at_;             /*!< When to stop the simulation */
+    uint32_t    exit_after_;          /*!< When (wall-time) to stop the simulation */
+    std::string partitioner_;         /*!< Partitioner to use */
+    double      imbalance_tolerance_; /*!< Allowed rank imbalance for the partitioner */
+    std::string heartbeatPeriod_;     /*!< Sets the heartbeat period for the simulation */
+    std::string output_directory_;    /*!< Output directory to dump all files to */
+    std::string output_core_prefix_;  /*!< Set the SST::Output prefix for the core */
 
     // Configuration output
     std::string output_config_graph_; /*!< File to dump configuration graph */
     std::string output_json_;         /*!< File to dump JSON output */
+    std::string output_binary_;       /*!< File to dump binary output */
     bool        parallel_output_;     /*!< Output simulation graph in parallel */
+    bool        parallel_output_mode_multi_; /*!< If true, output using a file per rank */
 
     // Graph output
     std::string output_dot_;               /*!< File to dump dot output */
@@ -465,6 +549,13 @@ private:
     bool        parallel_load_mode_multi_; /*!< If true, load using multiple files */
     std::string timeVortex_;               /*!< TimeVortex implementation to use */
     bool        interthread_links_;        /*!< Use interthread links */
+    bool        shared_memory_ranks_;      /*!< Use shared memory for ranks on the same node */
+    bool        async_rank_sync_;          /*!< Use the asynchronous rank sync */
+    bool        per_peer_lookahead_;       /*!< Use a separate lookahead for each pair of ranks */
+    bool        fifo_links_;               /*!< Queue same thread link events in FIFOs */
+    bool        untimed_quiescence_;       /*!< Skip idle components in untimed phases */
+    std::string barrier_type_;             /*!< Type of barrier used between threads */
+    std::string barrier_wait_;             /*!< How threads wait at barriers */
 #ifdef USE_MEMPOOL
     bool cache_align_mempools_; /*!< Cache align allocations from mempools */
 #endif
@@ -473,8 +564,10 @@ private:
     // std::string addLibPath_; ** in ConfigShared
 
     // Advanced options - profiling
-    std::string enabled_profiling_; /*!< Enabled default profiling points */
-    std::string profiling_output_;  /*!< Location to write profiling data */
+    std::string enabled_profiling_;        /*!< Enabled default profiling points */
+    std::string profiling_output_;         /*!< Location to write profiling data */
+    std::string output_component_weights_; /*!< File to write measured component weights */
+    std::string component_weights_;        /*!< File to read component weights from */
 
     // Advanced options - debug
     SimulationRunMode runMode_; /*!< Run Mode (Init, Both, Run-only) */
@@ -23,8 +23,13 @@
 #include "sst/core/warnmacros.h"
 
 #include <algorithm>
+#include <cinttypes>
 #include <fstream>
+#include <mutex>
+#include <set>
 #include <string.h>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace std;
 
@@ -73,11 +78,63 @@ checkForValidLinkName(const std::string& name)
 
 namespace SST {
 
+// Function local statics so that the table exists before any static
+// graph objects are constructed
+static std::unordered_set<std::string>&
+internTable()
+{
+    static std::unordered_set<std::string> table;
+    return table;
+}
+
+static std::mutex&
+internMutex()
+{
+    static std::mutex mtx;
+    return mtx;
+}
+
+const std::string*
+InternedString::intern(const std::string& s)
+{
+    // The elements of an unordered_set do not move on rehash, so the
+    // returned pointer stays valid
+    std::lock_guard<std::mutex> lock(internMutex());
+    return &*internTable().insert(s).first;
+}
+
+const std::string*
+InternedString::emptyString()
+{
+    // Every default constructed ConfigLink holds several empty
+    // strings, so look this one up once instead of taking the lock
+    static const std::string* empty = intern(std::string());
+    return empty;
+}
+
+size_t
+InternedString::tableSize()
+{
+    std::lock_guard<std::mutex> lock(internMutex());
+    return internTable().size();
+}
+
+static SimTime_t
+parseLatency(TimeLord* timeLord, const InternedString& str, std::map<const std::string*, SimTime_t>& cache)
+{
+    const std::string* key  = &str.get();
+    auto               iter = cache.find(key);
+    if ( iter != cache.end() ) return iter->second;
+    SimTime_t latency = timeLord->getSimCycles(str, "ConfigLink::updateLatencies");
+    cache[key]        = latency;
+    return latency;
+}
+
 void
-ConfigLink::updateLatencies(TimeLord* timeLord)
+ConfigLink::updateLatencies(TimeLord* timeLord, std::map<const std::string*, SimTime_t>& cache)
 {
     // Need to clean up some elements before we can test for zero latency
-    if ( order >= 1 ) { latency[0] = timeLord->getSimCycles(latency_str[0], __FUNCTION__); }
+    if ( order >= 1 ) { latency[0] = parseLatency(timeLord, latency_str[0], cache); }
     // if ( latency[0] == 0 ) {
     //     latency[0] = 1;
     //     if ( !zero_latency_warning ) {
@@ -87,7 +144,7 @@ ConfigLink::updateLatencies(TimeLord* timeLord)
     //         zero_latency_warning = true;
     //     }
     // }
-    if ( order >= 2 ) { latency[1] = timeLord->getSimCycles(latency_str[1], __FUNCTION__); }
+    if ( order >= 2 ) { latency[1] = parseLatency(timeLord, latency_str[1], cache); }
     // if ( latency[1] == 0 ) {
     //     latency[1] = 1;
     //     if ( !zero_latency_warning ) {
@@ -192,8 +249,8 @@ ConfigComponent::print(std::ostream& os) const
     for ( auto& pair : enabledStatNames ) {
         os << "    " << pair.first << std::endl;
         os << "      Params:" << std::endl;
-        auto iter = statistics.find(pair.second);
-        iter->second.params.print_all_params(os, "      ");
+        ConfigStatistic* cs = findStatistic(pair.second);
+        if ( cs ) cs->params.print_all_params(os, "      ");
     }
     os << "  SubComponents:\n";
     for ( auto* sc : subComponents ) {
@@ -345,7 +402,7 @@ ConfigComponent::createStatistic()
     ConfigStatistic* cs     = nullptr;
     if ( parent ) { cs = parent->insertStatistic(stat_id); }
     else {
-        cs = &statistics[stat_id];
+        cs = &statistics.insert(ConfigStatistic(stat_id));
     }
     cs->id = stat_id;
     return cs;
@@ -394,7 +451,7 @@ ConfigComponent::enableStatistic(const std::string& statisticName, const SST::Pa
         }
     }
 
-    ConfigStatistic& cs = statistics[stat_id];
+    ConfigStatistic& cs = statistics.insert(ConfigStatistic(stat_id));
     cs.id               = stat_id;
     cs.params.insert(params);
     return &cs;
@@ -419,8 +476,7 @@ ConfigComponent::reuseStatistic(const std::string& statisticName, StatisticId_t
         return false;
     }
 
-    auto iter = comp->statistics.find(sid);
-    if ( iter == comp->statistics.end() ) {
+    if ( !comp->statistics.contains(sid) ) {
         Output::getDefaultObject().fatal(CALL_INFO, 1, "Cannot reuse a statistic that doesn't exist for the parent");
         return false;
     }
@@ -563,7 +619,7 @@ ConfigComponent::insertStatistic(StatisticId_t sid)
     ConfigComponent* parent = getParent();
     if ( parent ) { return parent->insertStatistic(sid); }
     else {
-        return &statistics[sid];
+        return &statistics.insert(ConfigStatistic(sid));
     }
 }
 
@@ -586,11 +642,10 @@ ConfigComponent::findStatistic(StatisticId_t sid) const
     auto* parent = getParent();
     if ( parent ) { return parent->findStatistic(sid); }
     else {
-        auto iter = statistics.find(sid);
-        if ( iter == statistics.end() ) { return nullptr; }
+        if ( !statistics.contains(sid) ) { return nullptr; }
         else {
             // I hate that I have to do this
-            return const_cast<ConfigStatistic*>(&iter->second);
+            return const_cast<ConfigStatistic*>(&statistics[sid]);
         }
     }
 }
@@ -707,9 +762,10 @@ ConfigGraph::checkRanks(RankInfo ranks)
 void
 ConfigGraph::postCreationCleanup()
 {
-    TimeLord* timeLord = Simulation_impl::getTimeLord();
+    TimeLord*                               timeLord = Simulation_impl::getTimeLord();
+    std::map<const std::string*, SimTime_t> latencies;
     for ( ConfigLink* link : getLinkMap() ) {
-        link->updateLatencies(timeLord);
+        link->updateLatencies(timeLord, latencies);
     }
 
     LinkId_t count = 1;
@@ -719,6 +775,11 @@ ConfigGraph::postCreationCleanup()
         count++;
     }
 
+    // The name maps are only used while the model builds the graph,
+    // and partitioning deletes the objects their keys point into
+    link_names.clear();
+    compsByName.clear();
+
     /* Force component / statistic registration for Group stats */
     for ( auto& cfg : getStatGroups() ) {
         for ( ComponentId_t compID : cfg.second.components ) {
@@ -777,9 +838,9 @@ ConfigGraph::addComponent(const std::string& name, const std::string& type)
 {
     checkForValidComponentName(name);
     ComponentId_t cid = nextComponentId++;
-    comps.insert(new ConfigComponent(cid, this, name, type, 1.0f, RankInfo()));
+    ConfigComponent* comp = comps.insert(new ConfigComponent(cid, this, name, type, 1.0f, RankInfo()));
 
-    auto ret = compsByName.insert(std::make_pair(name, cid));
+    auto ret = compsByName.insert(std::make_pair(std::string_view(comp->name), cid));
     // Check to see if the name has already been used
     if ( !ret.second ) {
         output.fatal(CALL_INFO, 1, "ERROR: trying to add Component with name that already exists: %s\n", name.c_str());
@@ -787,6 +848,17 @@ ConfigGraph::addComponent(const std::string& name, const std::string& type)
     return cid;
 }
 
+void
+ConfigGraph::setNextComponentId(ComponentId_t id)
+{
+    if ( id < nextComponentId ) {
+        output.fatal(
+            CALL_INFO, 1, "ERROR: component ID %" PRIu64 " has already been used, next ID is %" PRIu64 "\n", id,
+            nextComponentId);
+    }
+    nextComponentId = id;
+}
+
 void
 ConfigGraph::addGlobalParam(const std::string& global_set, const std::string& key, const std::string& value)
 {
@@ -825,15 +897,21 @@ ConfigGraph::addLink(
     checkForValidLinkName(link_name);
 
     // If the link already exists, it just gets it out of the links
-    // data structure.  If the link does not exist, we create it, add
-    // the link_name to id mapping (the id is links.size()) and add
-    // the link to the links data structure.  The insert function
-    // returns a reference to the newly inserted link.
+    // data structure.  If the link does not exist, we create it (the
+    // id is links.size()), add it to the links data structure and add
+    // the name to id mapping, which views the name held by the link.
+    // The insert function returns a reference to the newly inserted
+    // link.
     auto link_name_it = link_names.find(link_name);
 
-    ConfigLink* link = (link_name_it == link_names.end())
-                           ? links.insert(new ConfigLink(link_names[link_name] = links.size(), link_name))
-                           : links[link_name_it->second];
+    ConfigLink* link;
+    if ( link_name_it == link_names.end() ) {
+        link                   = links.insert(new ConfigLink(links.size(), link_name));
+        link_names[link->name] = link->id;
+    }
+    else {
+        link = links[link_name_it->second];
+    }
 
     // Check to make sure the link has not been referenced too many
     // times.
@@ -866,9 +944,10 @@ void
 ConfigGraph::setLinkNoCut(const std::string& link_name)
 {
     // If link doesn't exist, return
-    if ( link_names.find(link_name) == link_names.end() ) return;
+    auto link_name_it = link_names.find(link_name);
+    if ( link_name_it == link_names.end() ) return;
 
-    ConfigLink* link = links[link_names[link_name]];
+    ConfigLink* link = links[link_name_it->second];
     link->no_cut     = true;
 }
 
@@ -1207,6 +1286,325 @@ ConfigGraph::splitGraph(const std::set<uint32_t>& orig_rank_set, const std::set<
     return graph;
 }
 
+std::vector<std::vector<ComponentId_t>>
+ConfigGraph::getComponentIdsByRank(uint32_t num_ranks)
+{
+    std::vector<std::vector<ComponentId_t>> ids(num_ranks);
+    for ( ConfigComponent* comp : comps ) {
+        ids[comp->rank.rank].push_back(comp->id);
+    }
+    return ids;
+}
+
+static void
+deleteComponentTree(ConfigComponent* comp)
+{
+    for ( ConfigComponent* sc : comp->subComponents ) {
+        if ( sc ) deleteComponentTree(sc);
+    }
+    delete comp;
+}
+
+// Move the links of the (sub)components in src into the matching
+// (sub)components in dest, which is a clone of the same component.
+// Ghosts built by different ranks of a parallel load may not have the
+// same subcomponents, so subcomponents dest doesn't have are moved
+// over whole.
+static void
+mergeGhostLinks(ConfigComponent* dest, ConfigComponent* src)
+{
+    dest->links.insert(dest->links.end(), src->links.begin(), src->links.end());
+    for ( ConfigComponent*& sub : src->subComponents ) {
+        ConfigComponent* match = dest->findSubComponent(sub->id);
+        if ( match ) { mergeGhostLinks(match, sub); }
+        else {
+            dest->subComponents.push_back(sub);
+            sub = nullptr;
+        }
+    }
+}
+
+ConfigGraph*
+ConfigGraph::getChunk(uint32_t rank, const std::vector<ComponentId_t>& ids, bool first, bool every_link)
+{
+    ConfigGraph* chunk = new ConfigGraph();
+
+    if ( first ) {
+        chunk->statOutputs   = statOutputs;
+        chunk->statLoadLevel = statLoadLevel;
+        for ( auto& kv : statGroups ) {
+            for ( ComponentId_t id : kv.second.components ) {
+                ConfigComponent* comp = findComponent(id);
+                if ( comp && comp->rank.rank == rank ) {
+                    chunk->statGroups.insert(kv);
+                    break;
+                }
+            }
+        }
+    }
+
+    std::vector<ConfigComponent*>             chunk_comps;
+    std::vector<ConfigLink*>                  chunk_links;
+    std::map<ComponentId_t, ConfigComponent*> ghosts;
+    for ( ComponentId_t id : ids ) {
+        ConfigComponent* comp = comps[id];
+        chunk_comps.push_back(comp);
+
+        for ( LinkId_t link_id : comp->allLinks() ) {
+            ConfigLink*      link = links[link_id];
+            ConfigComponent* ends[2];
+            ends[0] = comps[COMPONENT_ID_MASK(link->component[0])];
+            ends[1] = comps[COMPONENT_ID_MASK(link->component[1])];
+
+            if ( ends[0]->rank.rank == rank && ends[1]->rank.rank == rank ) {
+                // Send links inside the rank with the lower of the two
+                // components, so each is only sent once
+                if ( every_link || comp->id == std::min(ends[0]->id, ends[1]->id) ) chunk_links.push_back(link);
+                continue;
+            }
+
+            chunk_links.push_back(link);
+
+            // The other end needs a ghost component holding just the
+            // links into this rank
+            int               remote = ends[0]->rank.rank == rank ? 1 : 0;
+            ConfigComponent*& ghost  = ghosts[ends[remote]->id];
+            if ( ghost == nullptr ) {
+                ghost = ends[remote]->cloneWithoutLinksOrParams(chunk);
+                chunk_comps.push_back(ghost);
+            }
+            ghost->findSubComponent(link->component[remote])->links.push_back(link_id);
+        }
+    }
+
+    // Links to the same component twice show up twice
+    std::sort(chunk_links.begin(), chunk_links.end(), [](ConfigLink* a, ConfigLink* b) { return a->id < b->id; });
+    chunk_links.erase(std::unique(chunk_links.begin(), chunk_links.end()), chunk_links.end());
+
+    chunk->comps = ConfigComponentMap_t(chunk_comps);
+    chunk->links = ConfigLinkMap_t(chunk_links, true);
+    return chunk;
+}
+
+void
+ConfigGraph::releaseChunk(ConfigGraph* chunk)
+{
+    // Only the ghosts belong to the chunk
+    for ( ConfigComponent* comp : chunk->comps ) {
+        if ( comp->graph == chunk ) deleteComponentTree(comp);
+    }
+    delete chunk;
+}
+
+void
+ConfigGraph::deleteGhosts(uint32_t rank)
+{
+    std::vector<ConfigComponent*> kept;
+    for ( ConfigComponent* comp : comps ) {
+        if ( comp->rank.rank == rank ) { kept.push_back(comp); }
+        else {
+            deleteComponentTree(comp);
+        }
+    }
+    comps = ConfigComponentMap_t(kept, true);
+}
+
+static bool
+componentTreeHasLinks(const ConfigComponent* comp)
+{
+    if ( !comp->links.empty() ) return true;
+    for ( const ConfigComponent* sc : comp->subComponents ) {
+        if ( sc && componentTreeHasLinks(sc) ) return true;
+    }
+    return false;
+}
+
+void
+ConfigGraph::deleteUnlinkedGhosts(uint32_t rank)
+{
+    std::vector<ConfigComponent*> kept;
+    for ( ConfigComponent* comp : comps ) {
+        if ( comp->rank.rank == rank || componentTreeHasLinks(comp) ) { kept.push_back(comp); }
+        else {
+            compsByName.erase(std::string_view(comp->name));
+            deleteComponentTree(comp);
+        }
+    }
+    comps = ConfigComponentMap_t(kept, true);
+}
+
+void
+ConfigGraph::clear()
+{
+    for ( ConfigComponent* comp : comps ) {
+        deleteComponentTree(comp);
+    }
+    for ( ConfigLink* link : links ) {
+        delete link;
+    }
+    comps.clear();
+    links.clear();
+}
+
+void
+ConfigGraph::addChunks(std::vector<ConfigGraph*>& chunks)
+{
+    if ( chunks.empty() ) return;
+
+    statOutputs   = chunks[0]->statOutputs;
+    statLoadLevel = chunks[0]->statLoadLevel;
+
+    // Collect everything and sort once, since SparseVectorMap is slow
+    // for out of order inserts
+    std::map<ComponentId_t, ConfigComponent*> all_comps;
+    std::vector<ConfigLink*>                  all_links(links.begin(), links.end());
+    for ( ConfigComponent* comp : comps ) {
+        all_comps[comp->id] = comp;
+    }
+
+    std::set<std::string> merged_groups;
+    for ( ConfigGraph* chunk : chunks ) {
+        for ( auto& kv : chunk->statGroups ) {
+            auto iter = statGroups.find(kv.first);
+            if ( iter == statGroups.end() ) { statGroups.insert(kv); }
+            else {
+                // Chunks from different ranks each list their own
+                // components
+                std::vector<ComponentId_t>& group = iter->second.components;
+                group.insert(group.end(), kv.second.components.begin(), kv.second.components.end());
+                merged_groups.insert(kv.first);
+            }
+        }
+        all_links.insert(all_links.end(), chunk->links.begin(), chunk->links.end());
+        for ( ConfigComponent* comp : chunk->comps ) {
+            auto iter = all_comps.find(comp->id);
+            if ( iter == all_comps.end() ) { all_comps[comp->id] = comp; }
+            else {
+                // Another piece of a ghost component
+                mergeGhostLinks(iter->second, comp);
+                deleteComponentTree(comp);
+            }
+        }
+        delete chunk;
+    }
+    chunks.clear();
+
+    for ( const std::string& name : merged_groups ) {
+        std::vector<ComponentId_t>& group = statGroups[name].components;
+        std::sort(group.begin(), group.end());
+        group.erase(std::unique(group.begin(), group.end()), group.end());
+    }
+
+    std::vector<ConfigComponent*> sorted_comps;
+    sorted_comps.reserve(all_comps.size());
+    for ( auto& kv : all_comps ) {
+        sorted_comps.push_back(kv.second);
+    }
+    comps = ConfigComponentMap_t(sorted_comps, true);
+
+    // Links between ranks are in the chunks of both ranks when the
+    // chunks of all the ranks are added
+    std::sort(all_links.begin(), all_links.end(), [](ConfigLink* a, ConfigLink* b) { return a->id < b->id; });
+    std::vector<ConfigLink*> unique_links;
+    unique_links.reserve(all_links.size());
+    for ( ConfigLink* link : all_links ) {
+        if ( !unique_links.empty() && unique_links.back()->id == link->id ) { delete link; }
+        else {
+            unique_links.push_back(link);
+        }
+    }
+    links = ConfigLinkMap_t(unique_links, true);
+
+    setComponentConfigGraphPointers();
+}
+
+// Replace the link IDs of comp and its subcomponents with the IDs of
+// the links they map to
+static void
+renumberLinks(ConfigComponent* comp, const std::unordered_map<LinkId_t, ConfigLink*>& id_map)
+{
+    for ( LinkId_t& id : comp->links ) {
+        id = id_map.at(id)->id;
+    }
+    for ( ConfigComponent* sub : comp->subComponents ) {
+        renumberLinks(sub, id_map);
+    }
+}
+
+void
+ConfigGraph::addRankChunks(uint32_t rank, std::vector<ConfigGraph*>& chunks)
+{
+    // Keep the first copy of each link, filling in its ends from the
+    // copies sent by the ranks that owned the components on those ends
+    std::map<std::string_view, ConfigLink*>                by_name;
+    std::vector<std::unordered_map<LinkId_t, ConfigLink*>> id_maps(chunks.size());
+    for ( size_t i = 0; i < chunks.size(); i++ ) {
+        ConfigGraph* chunk = chunks[i];
+        for ( ConfigLink* link : chunk->links ) {
+            auto        inserted = by_name.emplace(link->name, link);
+            ConfigLink* kept     = inserted.first->second;
+            id_maps[i][link->id] = kept;
+            if ( inserted.second ) continue;
+
+            for ( int end = 0; end < 2; end++ ) {
+                ComponentId_t id = COMPONENT_ID_MASK(link->component[end]);
+                if ( !chunk->comps.contains(id) || chunk->comps[id]->rank.rank != rank ) continue;
+                kept->component[end]   = link->component[end];
+                kept->port[end]        = link->port[end];
+                kept->latency[end]     = link->latency[end];
+                kept->latency_str[end] = link->latency_str[end];
+            }
+            delete link;
+        }
+        chunk->links.clear();
+    }
+
+    // Number the links in order of name, and set the order the same
+    // way postCreationCleanup() does
+    std::vector<ConfigLink*> kept_links;
+    kept_links.reserve(by_name.size());
+    for ( auto& kv : by_name ) {
+        ConfigLink* link = kv.second;
+        link->id         = kept_links.size();
+        link->order      = kept_links.size() + 1;
+        kept_links.push_back(link);
+    }
+    for ( size_t i = 0; i < chunks.size(); i++ ) {
+        for ( ConfigComponent* comp : chunks[i]->comps ) {
+            renumberLinks(comp, id_maps[i]);
+        }
+    }
+    by_name.clear();
+
+    links = ConfigLinkMap_t(kept_links, true);
+    addChunks(chunks);
+}
+
+void
+ConfigGraph::remapParamKeys(const std::vector<std::string>& key_names)
+{
+    std::vector<ConfigComponent*> todo(comps.begin(), comps.end());
+    while ( !todo.empty() ) {
+        ConfigComponent* comp = todo.back();
+        todo.pop_back();
+        comp->params.remapKeys(key_names);
+        comp->allStatConfig.params.remapKeys(key_names);
+        for ( ConfigStatistic& stat : comp->statistics ) {
+            stat.params.remapKeys(key_names);
+        }
+        todo.insert(todo.end(), comp->subComponents.begin(), comp->subComponents.end());
+    }
+
+    for ( ConfigStatOutput& output : statOutputs ) {
+        output.params.remapKeys(key_names);
+    }
+    for ( auto& kv : statGroups ) {
+        for ( auto& stat : kv.second.statMap ) {
+            stat.second.remapKeys(key_names);
+        }
+    }
+}
+
 
 PartitionGraph*
 ConfigGraph::getPartitionGraph()
@@ -1319,8 +1717,10 @@ ConfigGraph::getCollapsedPartitionGraph()
         PartitionComponent* pcomp = *i;
         for ( LinkIdMap_t::iterator j = pcomp->links.begin(); j != pcomp->links.end(); ++j ) {
             PartitionLink& plink = plinks[*j];
-            if ( pcomp->group.contains(plink.component[0]) ) plink.component[0] = pcomp->id;
-            if ( pcomp->group.contains(plink.component[1]) ) plink.component[1] = pcomp->id;
+            // Links to subcomponents have the subcomponent bits set in
+            // the component ID
+            if ( pcomp->group.contains(COMPONENT_ID_MASK(plink.component[0])) ) plink.component[0] = pcomp->id;
+            if ( pcomp->group.contains(COMPONENT_ID_MASK(plink.component[1])) ) plink.component[1] = pcomp->id;
         }
     }
 
@@ -25,7 +25,9 @@
 
 #include <climits>
 #include <map>
+#include <ostream>
 #include <set>
+#include <string_view>
 #include <vector>
 
 using namespace SST::Statistics;
@@ -41,16 +43,57 @@ class ConfigGraph;
 typedef SparseVectorMap<ComponentId_t> ComponentIdMap_t;
 typedef std::vector<LinkId_t>          LinkIdMap_t;
 
+/**
+   String stored once in a table shared by the whole process.  Used for
+   the strings that repeat across the nodes of large graphs (component
+   types, port names and latencies), so each node only holds a pointer.
+   Strings are never removed from the table.
+ */
+class InternedString
+{
+public:
+    InternedString() : str(emptyString()) {}
+    InternedString(const std::string& s) : str(intern(s)) {}
+    InternedString(const char* s) : str(intern(s)) {}
+
+    InternedString& operator=(const std::string& s)
+    {
+        str = intern(s);
+        return *this;
+    }
+
+    operator const std::string&() const { return *str; }
+    const std::string& get() const { return *str; }
+    const char*        c_str() const { return str->c_str(); }
+    bool               empty() const { return str->empty(); }
+
+    bool operator==(const InternedString& o) const { return str == o.str; }
+    bool operator!=(const InternedString& o) const { return str != o.str; }
+    bool operator==(const std::string& o) const { return *str == o; }
+    bool operator!=(const std::string& o) const { return *str != o; }
+
+    friend std::ostream& operator<<(std::ostream& os, const InternedString& s) { return os << *s.str; }
+
+    /** Return the number of distinct strings in the table */
+    static size_t tableSize();
+
+private:
+    const std::string* str;
+
+    static const std::string* intern(const std::string& s);
+    static const std::string* emptyString();
+};
+
 /** Represents the configuration of a generic Link */
 class ConfigLink : public SST::Core::Serialization::serializable
 {
 public:
-    LinkId_t      id;             /*!< ID of this link */
-    std::string   name;           /*!< Name of this link */
-    ComponentId_t component[2];   /*!< IDs of the connected components */
-    std::string   port[2];        /*!< Names of the connected ports */
-    SimTime_t     latency[2];     /*!< Latency from each side */
-    std::string   latency_str[2]; /*!< Temp string holding latency */
+    LinkId_t       id;             /*!< ID of this link */
+    std::string    name;           /*!< Name of this link */
+    ComponentId_t  component[2];   /*!< IDs of the connected components */
+    InternedString port[2];        /*!< Names of the connected ports */
+    SimTime_t      latency[2];     /*!< Latency from each side */
+    InternedString latency_str[2]; /*!< Temp string holding latency */
 
     LinkId_t order;  /*!< Number of components currently referring to this Link.  After graph construction, it will
                        be repurposed to hold the enforce_order value */
@@ -94,6 +137,7 @@ public:
         ser& latency_str[0];
         ser& latency_str[1];
         ser& order;
+        ser& no_cut;
     }
 
     ImplementSerializable(SST::ConfigLink)
@@ -119,7 +163,9 @@ private:
         component[1] = ULONG_MAX;
     }
 
-    void updateLatencies(TimeLord*);
+    /** Convert the latency strings to SimTime_t.  Each distinct string
+     * is only parsed once across all the links sharing the cache. */
+    void updateLatencies(TimeLord*, std::map<const std::string*, SimTime_t>& cache);
 };
 
 class ConfigStatistic : public SST::Core::Serialization::serializable
@@ -139,6 +185,7 @@ public:
     ConfigStatistic() : id(stat_null_id) {}
 
     inline const StatisticId_t& getId() const { return id; }
+    inline const StatisticId_t& key() const { return id; }
 
     void addParameter(const std::string& key, const std::string& value, bool overwrite);
 
@@ -223,7 +270,7 @@ public:
     ConfigGraph*          graph;         /*!< Graph that this component belongs to */
     std::string           name;          /*!< Name of this component, or slot name for subcomp */
     int                   slot_num;      /*!< Slot number.  Only valid for subcomponents */
-    std::string           type;          /*!< Type of this component */
+    InternedString        type;          /*!< Type of this component */
     float                 weight;        /*!< Partitioning weight for this component */
     RankInfo              rank;          /*!< Parallel Rank for this component */
     std::vector<LinkId_t> links;         /*!< List of links connected */
@@ -323,7 +370,7 @@ public:
     ImplementSerializable(SST::ConfigComponent)
 
 private:
-    std::map<StatisticId_t, ConfigStatistic> statistics;
+    SparseVectorMap<StatisticId_t, ConfigStatistic> statistics;
 
     ComponentId_t getNextSubComponentID();
 
@@ -375,7 +422,7 @@ private:
 /** Map IDs to Components */
 typedef SparseVectorMap<ComponentId_t, ConfigComponent*> ConfigComponentMap_t;
 /** Map names to Components */
-typedef std::map<std::string, ComponentId_t>             ConfigComponentNameMap_t;
+typedef std::map<std::string_view, ComponentId_t>        ConfigComponentNameMap_t;
 /** Map names to Parameter Sets: XML only */
 typedef std::map<std::string, Params*>                   ParamsMap_t;
 /** Map names to variable values:  XML only */
@@ -425,6 +472,15 @@ public:
     /** Create a new component */
     ComponentId_t addComponent(const std::string& name, const std::string& type);
 
+    /** Return the ID that the next new component will get */
+    ComponentId_t getNextComponentId() const { return nextComponentId; }
+
+    /** Set the ID that the next new component will get.  Used by model
+     * generators that only create some of the components on each rank,
+     * so that a component gets the same ID on every rank.  IDs can
+     * only move forward. */
+    void setNextComponentId(ComponentId_t id);
+
     /** Add a parameter to a global param set */
     void addGlobalParam(const std::string& global_set, const std::string& key, const std::string& value);
 
@@ -491,6 +547,52 @@ public:
 
     ConfigGraph* splitGraph(const std::set<uint32_t>& orig_rank_set, const std::set<uint32_t>& new_rank_set);
 
+    /** Return the IDs of the components in each rank, in order of ID */
+    std::vector<std::vector<ComponentId_t>> getComponentIdsByRank(uint32_t num_ranks);
+
+    /** Create a chunk of the graph to stream to a rank.  The chunk
+     * holds the components in ids, which must all be in rank, the links
+     * connected to them and ghost copies of the components at the other
+     * end of links that leave the rank.  The components and links are
+     * shared with this graph, so the chunk must be freed with
+     * releaseChunk().  The first chunk for a rank also carries the
+     * statistic configuration.  Links inside the rank are only sent
+     * with the lower of their two components, unless every_link is
+     * set.
+     */
+    ConfigGraph* getChunk(uint32_t rank, const std::vector<ComponentId_t>& ids, bool first, bool every_link = false);
+    void         releaseChunk(ConfigGraph* chunk);
+
+    /** Delete the ghost components, which are the ones not in rank,
+     * from a chunk created by getChunk().  This lets the chunks of all
+     * the ranks be added to one graph. */
+    void deleteGhosts(uint32_t rank);
+
+    /** Delete the components not in rank that no link is connected
+     * to.  A parallel load adds every component so that links can find
+     * their ends, but only needs the ones at the other end of a link
+     * into rank.  Must be called before postCreationCleanup(). */
+    void deleteUnlinkedGhosts(uint32_t rank);
+
+    /** Add the chunks created by getChunk() to this graph, merging the
+     * ghost copies of the same component.  The chunks are deleted. */
+    void addChunks(std::vector<ConfigGraph*>& chunks);
+
+    /** Add the chunks that the ranks of a parallel loaded graph
+     * created with getChunk() for this rank, with every_link set, to
+     * this empty graph.  Each rank numbers its own links, so the links
+     * are matched by name and numbered again, and each end of a link
+     * is taken from the chunk that has the real component on that end.
+     * The chunks are deleted. */
+    void addRankChunks(uint32_t rank, std::vector<ConfigGraph*>& chunks);
+
+    /** Translate the parameter keys of a chunk received from a rank
+     * whose parameter key names are key_names */
+    void remapParamKeys(const std::vector<std::string>& key_names);
+
+    /** Delete all the components and links in the graph */
+    void clear();
+
     PartitionGraph* getPartitionGraph();
     PartitionGraph* getCollapsedPartitionGraph();
     void            annotateRanks(PartitionGraph* graph);
@@ -524,7 +626,10 @@ private:
     ConfigComponentNameMap_t               compsByName; // std::map
     std::map<std::string, ConfigStatGroup> statGroups;
 
-    std::map<std::string, LinkId_t> link_names;
+    // The keys of compsByName and link_names view the names held by
+    // the components and links, so each name is only stored once.
+    // Both are cleared by postCreationCleanup().
+    std::map<std::string_view, LinkId_t> link_names;
 
     std::vector<ConfigStatOutput> statOutputs; // [0] is default
     uint8_t                       statLoadLevel;
@@ -641,4 +746,25 @@ public:
 
 } // namespace SST
 
+namespace SST {
+namespace Core {
+namespace Serialization {
+
+template <>
+class serialize<SST::InternedString>
+{
+public:
+    void operator()(SST::InternedString& s, SST::Core::Serialization::serializer& ser)
+    {
+        // Send the string itself and intern it again on the other side
+        std::string str = s;
+        ser&        str;
+        if ( ser.mode() == serializer::UNPACK ) s = str;
+    }
+};
+
+} // namespace Serialization
+} // namespace Core
+} // namespace SST
+
 #endif // SST_CORE_CONFIGGRAPH_H
@@ -54,9 +54,12 @@ protected:
 class ConfigGraphOutput
 {
 public:
-    ConfigGraphOutput(const char* path) { outputFile = fopen(path, "wt"); }
+    ConfigGraphOutput(const char* path) { openFile(path); }
 
-    virtual ~ConfigGraphOutput() { fclose(outputFile); }
+    virtual ~ConfigGraphOutput()
+    {
+        if ( nullptr != outputFile ) fclose(outputFile);
+    }
 
     /**
      * @param cfg Constant pointer to SST configuration
@@ -66,6 +69,26 @@ public:
     virtual void generate(const Config* cfg, ConfigGraph* graph) = 0;
 
 protected:
+    /** Size of the buffer used for the output file */
+    static constexpr size_t output_buffer_size = 1024 * 1024;
+
+    /**
+     * For outputs that open the file themselves
+     */
+    ConfigGraphOutput() : outputFile(nullptr) {}
+
+    /**
+     * Open the output file
+     *
+     * @param path File to write to
+     */
+    void openFile(const char* path)
+    {
+        outputFile = fopen(path, "wt");
+        // Graphs can be very large, so write them out in big blocks
+        if ( nullptr != outputFile ) setvbuf(outputFile, nullptr, _IOFBF, output_buffer_size);
+    }
+
     FILE* outputFile;
 
     /**
@@ -114,6 +137,15 @@ protected:
     {
         return params.getSubscribedGlobalParamSets();
     }
+
+
+    /**
+     * Serialize the table of parameter keys and the global param
+     * sets, which have to be saved along with any serialized Params
+     *
+     * @param ser Serializer to use
+     */
+    static void serializeParamKeyMaps(SST::Core::Serialization::serializer& ser) { Params::serializeKeyMaps(ser); }
 };
 
 } // namespace Core
@@ -0,0 +1,528 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/labelprop.h"
+
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/warnmacros.h"
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#define UNUSED_WO_MPI(x) x
+#else
+#define UNUSED_WO_MPI(x) UNUSED(x)
+#endif
+
+#include <algorithm>
+#include <cinttypes>
+#include <limits>
+#include <unordered_map>
+
+using namespace std;
+using namespace SST::IMPL::Partition;
+
+// Maximum number of label propagation rounds
+static const int max_rounds = 20;
+// Vertex number of ghost components no rank owns
+static const uint64_t no_vertex = std::numeric_limits<uint64_t>::max();
+
+static_assert(sizeof(size_t) == sizeof(uint64_t), "Graph indices are sent as 64 bit integers");
+
+SSTLabelPropagationPartition::SSTLabelPropagationPartition(
+    RankInfo total_ranks, RankInfo my_rank, int verbosity) :
+    SSTMultilevelPartition(total_ranks, my_rank, verbosity),
+    rank(my_rank)
+{
+    delete partOutput;
+    partOutput = new Output("LabelPropagationPartition ", verbosity, 0, SST::Output::STDOUT);
+}
+
+void
+SSTLabelPropagationPartition::performPartition(PartitionGraph* pgraph)
+{
+    const uint32_t num_parts = world_size.rank * world_size.thread;
+    const uint32_t num_ranks = world_size.rank;
+
+    // Only rank 0 has the graph
+    vector<PartitionComponent*> comps;
+    Graph                       graph;
+    uint64_t                    num_vertices = 0;
+    if ( rank.rank == 0 ) {
+        partOutput->verbose(CALL_INFO, 1, 0, "Performing a label propagation partition scheme for simulation model.\n");
+        partOutput->verbose(
+            CALL_INFO, 1, 0, "- Component Count:                  %10zu\n", pgraph->getNumComponents());
+        partOutput->verbose(CALL_INFO, 1, 0, "- Part Count:                       %10" PRIu32 "\n", num_parts);
+
+        buildGraph(pgraph, comps, graph);
+        num_vertices = graph.size();
+    }
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Bcast(&num_vertices, 1, MPI_UINT64_T, 0, MPI_COMM_WORLD);
+#endif
+    if ( num_vertices == 0 ) return;
+
+    vector<uint64_t> firsts(num_ranks + 1);
+    for ( uint32_t r = 0; r <= num_ranks; r++ )
+        firsts[r] = num_vertices * r / num_ranks;
+
+    Slice slice;
+    scatterGraph(graph, firsts, slice);
+    graph = Graph();
+
+    const size_t num_local = slice.vwgt.size();
+
+    // Start with a linear split of the vertices by weight
+    double local_weight = 0.0;
+    for ( double w : slice.vwgt )
+        local_weight += w;
+    double offset       = 0.0;
+    double total_weight = local_weight;
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Exscan(&local_weight, &offset, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    if ( rank.rank == 0 ) offset = 0.0;
+    MPI_Allreduce(&local_weight, &total_weight, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+    vector<uint32_t> parts(num_local, 0);
+    for ( size_t v = 0; v < num_local; v++ ) {
+        double middle = offset + slice.vwgt[v] / 2.0;
+        parts[v]      = std::min(num_parts - 1, (uint32_t)(middle * num_parts / total_weight));
+        offset += slice.vwgt[v];
+    }
+
+    vector<uint64_t> ghosts;
+    refine(slice, firsts, vector<bool>(num_local, false), parts, ghosts);
+
+    // Gather the parts back onto rank 0
+    vector<uint32_t> all_parts;
+#ifdef SST_CONFIG_HAVE_MPI
+    {
+        vector<int> counts(num_ranks);
+        vector<int> displs(num_ranks);
+        for ( uint32_t r = 0; r < num_ranks; r++ ) {
+            counts[r] = firsts[r + 1] - firsts[r];
+            displs[r] = firsts[r];
+        }
+        if ( rank.rank == 0 ) all_parts.resize(num_vertices);
+        MPI_Gatherv(
+            parts.data(), num_local, MPI_UINT32_T, all_parts.data(), counts.data(), displs.data(), MPI_UINT32_T, 0,
+            MPI_COMM_WORLD);
+    }
+#else
+    all_parts.assign(parts.begin(), parts.begin() + num_local);
+#endif
+
+    if ( rank.rank == 0 ) {
+        for ( size_t v = 0; v < comps.size(); v++ ) {
+            comps[v]->rank = RankInfo(all_parts[v] / world_size.thread, all_parts[v] % world_size.thread);
+        }
+        partOutput->verbose(CALL_INFO, 1, 0, "Label propagation partition scheme completed.\n");
+    }
+}
+
+void
+SSTLabelPropagationPartition::performParallelPartition(ConfigGraph* graph)
+{
+    const uint32_t num_parts = world_size.rank * world_size.thread;
+    const uint32_t num_ranks = world_size.rank;
+
+    // The local vertices are this rank's components, in order of ID.
+    // The rest of the components in the graph are ghosts.
+    ConfigComponentMap_t&    comp_map = graph->getComponentMap();
+    ConfigLinkMap_t&         link_map = graph->getLinkMap();
+    vector<ConfigComponent*> comps;
+    vector<ConfigComponent*> ghost_comps;
+    for ( ConfigComponent* comp : comp_map ) {
+        if ( comp->rank.rank == rank.rank )
+            comps.push_back(comp);
+        else
+            ghost_comps.push_back(comp);
+    }
+
+    // Number the vertices by rank, so each rank owns a contiguous slice
+    uint64_t         num_local = comps.size();
+    vector<uint64_t> firsts(num_ranks + 1, 0);
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Allgather(&num_local, 1, MPI_UINT64_T, firsts.data() + 1, 1, MPI_UINT64_T, MPI_COMM_WORLD);
+#else
+    firsts[1] = num_local;
+#endif
+    for ( uint32_t r = 0; r < num_ranks; r++ )
+        firsts[r + 1] += firsts[r];
+
+    if ( rank.rank == 0 ) {
+        partOutput->verbose(
+            CALL_INFO, 1, 0, "Performing a label propagation partition scheme for parallel loaded model.\n");
+        partOutput->verbose(CALL_INFO, 1, 0, "- Component Count:                  %10" PRIu64 "\n", firsts[num_ranks]);
+        partOutput->verbose(CALL_INFO, 1, 0, "- Part Count:                       %10" PRIu32 "\n", num_parts);
+    }
+    if ( firsts[num_ranks] == 0 ) return;
+
+    Slice slice;
+    slice.first = firsts[rank.rank];
+
+    unordered_map<ComponentId_t, uint64_t> index;
+    for ( size_t v = 0; v < num_local; v++ )
+        index[comps[v]->id] = slice.first + v;
+
+    // Ask the rank each ghost is on for its vertex number
+    vector<uint64_t> ghost_numbers(ghost_comps.size(), no_vertex);
+#ifdef SST_CONFIG_HAVE_MPI
+    {
+        vector<int> query_counts(num_ranks, 0);
+        for ( ConfigComponent* comp : ghost_comps ) {
+            if ( comp->rank.rank >= num_ranks ) {
+                partOutput->fatal(
+                    CALL_INFO, 1, "Component %s is on rank %" PRIu32 ", but there are only %" PRIu32 " ranks\n",
+                    comp->name.c_str(), comp->rank.rank, num_ranks);
+            }
+            query_counts[comp->rank.rank]++;
+        }
+        vector<int> answer_counts(num_ranks);
+        MPI_Alltoall(query_counts.data(), 1, MPI_INT, answer_counts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+        vector<int> query_displs(num_ranks, 0);
+        vector<int> answer_displs(num_ranks, 0);
+        for ( uint32_t r = 1; r < num_ranks; r++ ) {
+            query_displs[r]  = query_displs[r - 1] + query_counts[r - 1];
+            answer_displs[r] = answer_displs[r - 1] + answer_counts[r - 1];
+        }
+
+        // Sorting the ghosts by rank puts them in the order they are sent
+        std::stable_sort(ghost_comps.begin(), ghost_comps.end(), [](ConfigComponent* a, ConfigComponent* b) {
+            return a->rank.rank < b->rank.rank;
+        });
+        vector<uint64_t> queries;
+        for ( ConfigComponent* comp : ghost_comps )
+            queries.push_back(comp->id);
+
+        vector<uint64_t> asked(answer_displs[num_ranks - 1] + answer_counts[num_ranks - 1]);
+        MPI_Alltoallv(
+            queries.data(), query_counts.data(), query_displs.data(), MPI_UINT64_T, asked.data(), answer_counts.data(),
+            answer_displs.data(), MPI_UINT64_T, MPI_COMM_WORLD);
+        for ( uint64_t& id : asked ) {
+            auto iter = index.find(id);
+            id        = iter == index.end() ? no_vertex : iter->second;
+        }
+        MPI_Alltoallv(
+            asked.data(), answer_counts.data(), answer_displs.data(), MPI_UINT64_T, ghost_numbers.data(),
+            query_counts.data(), query_displs.data(), MPI_UINT64_T, MPI_COMM_WORLD);
+    }
+#endif
+    for ( size_t i = 0; i < ghost_comps.size(); i++ ) {
+        if ( ghost_numbers[i] != no_vertex ) index[ghost_comps[i]->id] = ghost_numbers[i];
+    }
+
+    // Build this rank's slice of the graph.  Components with no-cut
+    // links keep the rank and thread the model gave them, since the
+    // components at the other end do too.
+    vector<bool>                    pinned(num_local, false);
+    unordered_map<uint64_t, size_t> pos;
+    double                          local_weight = 0.0;
+    slice.xadj.push_back(0);
+    for ( size_t v = 0; v < num_local; v++ ) {
+        ConfigComponent* comp = comps[v];
+        slice.vwgt.push_back(comp->weight);
+        local_weight += comp->weight;
+
+        // Parallel links between two components are combined into a
+        // single edge
+        pos.clear();
+        for ( LinkId_t id : comp->allLinks() ) {
+            ConfigLink*   link  = link_map[id];
+            ComponentId_t end0  = COMPONENT_ID_MASK(link->component[0]);
+            ComponentId_t other = end0 == comp->id ? COMPONENT_ID_MASK(link->component[1]) : end0;
+            if ( link->no_cut ) pinned[v] = true;
+            if ( other == comp->id ) continue;
+
+            auto u = index.find(other);
+            if ( u == index.end() ) continue;
+
+            // Low latency links are the most expensive to cut
+            double w        = 1.0 / std::max(link->getMinLatency(), (SimTime_t)1);
+            auto   inserted = pos.emplace(u->second, slice.adjncy.size());
+            if ( inserted.second ) {
+                slice.adjncy.push_back(u->second);
+                slice.adjwgt.push_back(w);
+            }
+            else {
+                slice.adjwgt[inserted.first->second] += w;
+            }
+        }
+        slice.xadj.push_back(slice.adjncy.size());
+    }
+    index = unordered_map<ComponentId_t, uint64_t>();
+
+    // Balance on component count if no weights were given
+    double total_weight = local_weight;
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Allreduce(&local_weight, &total_weight, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+    if ( total_weight <= 0.0 ) std::fill(slice.vwgt.begin(), slice.vwgt.end(), 1.0);
+
+    // Start from the partition the model gave
+    vector<uint32_t> parts(num_local);
+    for ( size_t v = 0; v < num_local; v++ ) {
+        uint32_t thread = std::min(comps[v]->rank.thread, world_size.thread - 1);
+        parts[v]        = rank.rank * world_size.thread + thread;
+    }
+
+    vector<uint64_t> ghosts;
+    refine(slice, firsts, pinned, parts, ghosts);
+
+    for ( size_t v = 0; v < num_local; v++ ) {
+        comps[v]->setRank(RankInfo(parts[v] / world_size.thread, parts[v] % world_size.thread));
+    }
+
+    // The ghosts linked to this rank's components get their new ranks
+    // from the parts exchanged by refine()
+    for ( size_t i = 0; i < ghost_comps.size(); i++ ) {
+        auto iter = std::lower_bound(ghosts.begin(), ghosts.end(), ghost_numbers[i]);
+        if ( iter == ghosts.end() || *iter != ghost_numbers[i] ) continue;
+        uint32_t part = parts[num_local + (iter - ghosts.begin())];
+        ghost_comps[i]->setRank(RankInfo(part / world_size.thread, part % world_size.thread));
+    }
+
+    if ( rank.rank == 0 ) partOutput->verbose(CALL_INFO, 1, 0, "Label propagation partition scheme completed.\n");
+}
+
+void
+SSTLabelPropagationPartition::refine(
+    Slice& slice, const vector<uint64_t>& firsts, const vector<bool>& pinned, vector<uint32_t>& parts,
+    vector<uint64_t>& ghosts)
+{
+    const uint32_t num_parts = world_size.rank * world_size.thread;
+    const uint32_t num_ranks = world_size.rank;
+    const size_t   num_local = slice.vwgt.size();
+
+    auto owner = [&firsts](uint64_t v) -> int {
+        return std::upper_bound(firsts.begin(), firsts.end(), v) - firsts.begin() - 1;
+    };
+
+    // Find the ghost vertices, the neighbours owned by other ranks.
+    // Sorting them groups them by owner.
+    ghosts.clear();
+    for ( uint64_t v : slice.adjncy ) {
+        if ( v < slice.first || v >= slice.first + num_local ) ghosts.push_back(v);
+    }
+    std::sort(ghosts.begin(), ghosts.end());
+    ghosts.erase(std::unique(ghosts.begin(), ghosts.end()), ghosts.end());
+
+    vector<int> recv_counts(num_ranks, 0);
+    for ( uint64_t v : ghosts )
+        recv_counts[owner(v)]++;
+
+    // Ask the owners for their vertices
+    vector<vector<uint64_t>> send_ids(num_ranks);
+#ifdef SST_CONFIG_HAVE_MPI
+    {
+        vector<int> send_counts(num_ranks);
+        MPI_Alltoall(recv_counts.data(), 1, MPI_INT, send_counts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+        vector<int> recv_displs(num_ranks, 0);
+        vector<int> send_displs(num_ranks, 0);
+        for ( uint32_t r = 1; r < num_ranks; r++ ) {
+            recv_displs[r] = recv_displs[r - 1] + recv_counts[r - 1];
+            send_displs[r] = send_displs[r - 1] + send_counts[r - 1];
+        }
+        vector<uint64_t> requests(send_displs[num_ranks - 1] + send_counts[num_ranks - 1]);
+        MPI_Alltoallv(
+            ghosts.data(), recv_counts.data(), recv_displs.data(), MPI_UINT64_T, requests.data(), send_counts.data(),
+            send_displs.data(), MPI_UINT64_T, MPI_COMM_WORLD);
+        for ( uint32_t r = 0; r < num_ranks; r++ )
+            send_ids[r].assign(requests.begin() + send_displs[r], requests.begin() + send_displs[r] + send_counts[r]);
+    }
+#endif
+
+    // Renumber the edges to index the parts, which has the local
+    // vertices followed by the ghosts
+    {
+        unordered_map<uint64_t, uint64_t> ghost_index;
+        for ( size_t i = 0; i < ghosts.size(); i++ )
+            ghost_index[ghosts[i]] = num_local + i;
+        for ( uint64_t& v : slice.adjncy ) {
+            if ( v >= slice.first && v < slice.first + num_local )
+                v -= slice.first;
+            else
+                v = ghost_index[v];
+        }
+    }
+
+    double local_weight = 0.0;
+    double max_vwgt     = 0.0;
+    for ( double w : slice.vwgt ) {
+        local_weight += w;
+        max_vwgt = std::max(max_vwgt, w);
+    }
+    double total_weight = local_weight;
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Allreduce(&local_weight, &total_weight, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, &max_vwgt, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#endif
+
+    parts.resize(num_local + ghosts.size(), 0);
+    exchangeGhosts(send_ids, recv_counts, slice, parts);
+
+    const double average  = total_weight / num_parts;
+    const double max_part = std::max(average * (1.0 + imbalance_tolerance), average + max_vwgt);
+
+    vector<double> part_weight(num_parts);
+    auto           sumPartWeights = [&]() {
+        std::fill(part_weight.begin(), part_weight.end(), 0.0);
+        for ( size_t v = 0; v < num_local; v++ )
+            part_weight[parts[v]] += slice.vwgt[v];
+#ifdef SST_CONFIG_HAVE_MPI
+        MPI_Allreduce(MPI_IN_PLACE, part_weight.data(), num_parts, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+    };
+    sumPartWeights();
+
+    vector<double>   score(num_parts, 0.0);
+    vector<uint32_t> touched;
+    vector<double>   budget(num_parts);
+    vector<double>   added(num_parts);
+    for ( int round = 0; round < max_rounds; round++ ) {
+        // Each rank may add an equal share of the room left in each
+        // part, so the parts can not overflow between exchanges
+        for ( uint32_t p = 0; p < num_parts; p++ ) {
+            budget[p] = std::max(0.0, max_part - part_weight[p]) / num_ranks;
+            added[p]  = 0.0;
+        }
+
+        uint64_t moved = 0;
+        for ( size_t v = 0; v < num_local; v++ ) {
+            if ( pinned[v] ) continue;
+
+            // Connection to each neighbouring part
+            touched.clear();
+            for ( size_t e = slice.xadj[v]; e < slice.xadj[v + 1]; e++ ) {
+                uint32_t p = parts[slice.adjncy[e]];
+                if ( score[p] == 0.0 ) touched.push_back(p);
+                score[p] += slice.adjwgt[e];
+            }
+
+            uint32_t current = parts[v];
+            uint32_t best    = current;
+            for ( uint32_t p : touched ) {
+                if ( score[p] > score[best] && added[p] + slice.vwgt[v] <= budget[p] ) best = p;
+            }
+            for ( uint32_t p : touched )
+                score[p] = 0.0;
+
+            if ( best != current ) {
+                parts[v] = best;
+                added[best] += slice.vwgt[v];
+                moved++;
+            }
+        }
+
+#ifdef SST_CONFIG_HAVE_MPI
+        MPI_Allreduce(MPI_IN_PLACE, &moved, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+#endif
+        if ( rank.rank == 0 )
+            partOutput->verbose(CALL_INFO, 2, 0, "Round %d moved %" PRIu64 " vertices\n", round, moved);
+        if ( moved == 0 ) break;
+
+        sumPartWeights();
+        exchangeGhosts(send_ids, recv_counts, slice, parts);
+    }
+}
+
+void
+SSTLabelPropagationPartition::scatterGraph(const Graph& graph, const vector<uint64_t>& firsts, Slice& slice)
+{
+    slice.first            = firsts[rank.rank];
+    const size_t num_local = firsts[rank.rank + 1] - firsts[rank.rank];
+
+#ifdef SST_CONFIG_HAVE_MPI
+    const uint32_t num_ranks = world_size.rank;
+
+    // Send the vertex degrees rather than the offsets, since the
+    // slices of the offsets would overlap
+    vector<int>      vertex_counts(num_ranks);
+    vector<int>      vertex_displs(num_ranks);
+    vector<int>      edge_counts(num_ranks);
+    vector<int>      edge_displs(num_ranks);
+    vector<uint64_t> degree;
+    if ( rank.rank == 0 ) {
+        for ( uint32_t r = 0; r < num_ranks; r++ ) {
+            vertex_counts[r] = firsts[r + 1] - firsts[r];
+            vertex_displs[r] = firsts[r];
+            edge_counts[r]   = graph.xadj[firsts[r + 1]] - graph.xadj[firsts[r]];
+            edge_displs[r]   = graph.xadj[firsts[r]];
+        }
+        degree.resize(graph.size());
+        for ( size_t v = 0; v < graph.size(); v++ )
+            degree[v] = graph.xadj[v + 1] - graph.xadj[v];
+    }
+
+    slice.vwgt.resize(num_local);
+    slice.xadj.resize(num_local + 1);
+    MPI_Scatterv(
+        graph.vwgt.data(), vertex_counts.data(), vertex_displs.data(), MPI_DOUBLE, slice.vwgt.data(), num_local,
+        MPI_DOUBLE, 0, MPI_COMM_WORLD);
+    MPI_Scatterv(
+        degree.data(), vertex_counts.data(), vertex_displs.data(), MPI_UINT64_T, slice.xadj.data() + 1, num_local,
+        MPI_UINT64_T, 0, MPI_COMM_WORLD);
+    slice.xadj[0] = 0;
+    for ( size_t v = 0; v < num_local; v++ )
+        slice.xadj[v + 1] += slice.xadj[v];
+
+    const size_t num_edges = slice.xadj[num_local];
+    slice.adjncy.resize(num_edges);
+    slice.adjwgt.resize(num_edges);
+    MPI_Scatterv(
+        graph.adjncy.data(), edge_counts.data(), edge_displs.data(), MPI_UINT64_T, slice.adjncy.data(), num_edges,
+        MPI_UINT64_T, 0, MPI_COMM_WORLD);
+    MPI_Scatterv(
+        graph.adjwgt.data(), edge_counts.data(), edge_displs.data(), MPI_DOUBLE, slice.adjwgt.data(), num_edges,
+        MPI_DOUBLE, 0, MPI_COMM_WORLD);
+#else
+    slice.vwgt.assign(graph.vwgt.begin(), graph.vwgt.begin() + num_local);
+    slice.xadj.assign(graph.xadj.begin(), graph.xadj.end());
+    slice.adjncy.assign(graph.adjncy.begin(), graph.adjncy.end());
+    slice.adjwgt.assign(graph.adjwgt.begin(), graph.adjwgt.end());
+#endif
+}
+
+void
+SSTLabelPropagationPartition::exchangeGhosts(
+    const vector<vector<uint64_t>>& UNUSED_WO_MPI(send_ids), const vector<int>& UNUSED_WO_MPI(recv_counts),
+    const Slice& UNUSED_WO_MPI(slice), vector<uint32_t>& UNUSED_WO_MPI(parts))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    const uint32_t num_ranks = world_size.rank;
+    const size_t   num_local = slice.vwgt.size();
+
+    vector<int>      send_counts(num_ranks);
+    vector<int>      send_displs(num_ranks, 0);
+    vector<int>      recv_displs(num_ranks, 0);
+    vector<uint32_t> send_parts;
+    for ( uint32_t r = 0; r < num_ranks; r++ ) {
+        send_counts[r] = send_ids[r].size();
+        if ( r > 0 ) {
+            send_displs[r] = send_displs[r - 1] + send_counts[r - 1];
+            recv_displs[r] = recv_displs[r - 1] + recv_counts[r - 1];
+        }
+        for ( uint64_t v : send_ids[r] )
+            send_parts.push_back(parts[v - slice.first]);
+    }
+
+    MPI_Alltoallv(
+        send_parts.data(), send_counts.data(), send_displs.data(), MPI_UINT32_T, parts.data() + num_local,
+        recv_counts.data(), recv_displs.data(), MPI_UINT32_T, MPI_COMM_WORLD);
+#endif
+}
@@ -0,0 +1,124 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_LABELPROP_H
+#define SST_CORE_IMPL_PARTITONERS_LABELPROP_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/impl/partitioners/multilevel.h"
+#include "sst/core/sst_types.h"
+
+#include <vector>
+
+namespace SST {
+namespace IMPL {
+namespace Partition {
+
+/**
+Partitioner that is run cooperatively by all the ranks using size
+constrained label propagation.
+
+Rank 0 builds the graph of the components and scatters it, so each
+rank owns a contiguous slice of the vertices.  The parts start as a
+linear split of the vertices by weight.  When the model is loaded in
+parallel, each rank instead builds the slice for its own components
+from its part of the graph, and the parts start as the ranks and
+threads the model gave the components.  In each round every rank
+moves its vertices to the part most strongly connected to them, as
+long as the part stays within the imbalance tolerance, and then
+exchanges the parts of the vertices on its boundary with the ranks
+that own their neighbours.  The parts are gathered back onto rank 0,
+or for a parallel load are set on each rank's components and their
+ghosts, so the components can be moved to their new ranks.
+
+Components with no-cut links keep the part the model gave them when
+the model is loaded in parallel.
+
+Edges are weighted by the inverse of the link latency, as in the
+multilevel partitioner.
+*/
+class SSTLabelPropagationPartition : public SSTMultilevelPartition
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTLabelPropagationPartition,
+        "sst",
+        "labelprop",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Distributed label propagation partitioner that runs on all ranks.  Also refines the partition of parallel loaded models.")
+
+    /**
+       Creates a new label propagation partition scheme.
+       \param total_ranks Number of ranks and threads in the simulation
+       \param my_rank Rank of this process
+       \param verbosity The level of information to output
+    */
+    SSTLabelPropagationPartition(RankInfo total_ranks, RankInfo my_rank, int verbosity);
+
+    /**
+       Performs a partition of an SST simulation configuration.  Only
+       rank 0 has the graph, the other ranks get an empty one.
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(PartitionGraph* graph) override;
+
+    /**
+       Refines the partition of a parallel loaded configuration.  Each
+       rank has its own components and ghosts of their neighbours.
+       \param graph This rank's part of the simulation configuration
+    */
+    void performParallelPartition(ConfigGraph* graph) override;
+
+    bool spawnOnAllRanks() override { return true; }
+
+    bool supportsParallelLoad() override { return true; }
+
+private:
+    /** Rank of this process */
+    RankInfo rank;
+
+    /** Slice of the graph owned by this rank.  Edges use global
+     * vertex numbers. */
+    struct Slice
+    {
+        uint64_t              first; // global number of the first vertex
+        std::vector<double>   vwgt;
+        std::vector<uint64_t> xadj;
+        std::vector<uint64_t> adjncy;
+        std::vector<double>   adjwgt;
+    };
+
+    // Scatter the graph from rank 0, giving each rank the vertices
+    // from firsts[rank] up to firsts[rank + 1]
+    void scatterGraph(const Graph& graph, const std::vector<uint64_t>& firsts, Slice& slice);
+
+    // Run the label propagation rounds on the slice.  parts holds the
+    // starting part of each local vertex, and on return is followed by
+    // the parts of the ghost vertices, whose numbers are in ghosts.
+    // Pinned vertices are not moved.
+    void refine(
+        Slice& slice, const std::vector<uint64_t>& firsts, const std::vector<bool>& pinned,
+        std::vector<uint32_t>& parts, std::vector<uint64_t>& ghosts);
+
+    // Send the parts of the vertices in send_ids to each rank and
+    // receive the parts of the ghost vertices, which follow the local
+    // vertices in parts
+    void exchangeGhosts(
+        const std::vector<std::vector<uint64_t>>& send_ids, const std::vector<int>& recv_counts, const Slice& slice,
+        std::vector<uint32_t>& parts);
+};
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_PARTITONERS_LABELPROP_H
@@ -0,0 +1,198 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/latency.h"
+
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <numeric>
+#include <unordered_map>
+
+using namespace std;
+using namespace SST::IMPL::Partition;
+
+typedef SSTMultilevelPartition::Graph Graph;
+
+static size_t
+findRoot(vector<size_t>& root, size_t v)
+{
+    while ( root[v] != v ) {
+        root[v] = root[root[v]];
+        v       = root[v];
+    }
+    return v;
+}
+
+// Extract the vertices in part p, filling in ids with the original
+// vertex for each
+static Graph
+extractPart(const Graph& graph, const vector<uint32_t>& part, uint32_t p, vector<size_t>& ids)
+{
+    vector<size_t> local(graph.size(), 0);
+    for ( size_t v = 0; v < graph.size(); v++ ) {
+        if ( part[v] != p ) continue;
+        local[v] = ids.size();
+        ids.push_back(v);
+    }
+
+    Graph sub;
+    sub.xadj.push_back(0);
+    for ( size_t v : ids ) {
+        sub.vwgt.push_back(graph.vwgt[v]);
+        for ( size_t e = graph.xadj[v]; e < graph.xadj[v + 1]; e++ ) {
+            size_t u = graph.adjncy[e];
+            if ( part[u] != p ) continue;
+            sub.adjncy.push_back(local[u]);
+            sub.adjwgt.push_back(graph.adjwgt[e]);
+        }
+        sub.xadj.push_back(sub.adjncy.size());
+    }
+    return sub;
+}
+
+SSTLatencyPartition::SSTLatencyPartition(RankInfo total_ranks, RankInfo my_rank, int verbosity) :
+    SSTMultilevelPartition(total_ranks, my_rank, verbosity),
+    rank_imbalance_tolerance(0.05)
+{
+    delete partOutput;
+    partOutput = new Output("LatencyPartition ", verbosity, 0, SST::Output::STDOUT);
+}
+
+void
+SSTLatencyPartition::performPartition(PartitionGraph* pgraph)
+{
+    PartitionLinkMap_t& linkMap = pgraph->getLinkMap();
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a latency aware partition scheme for simulation model.\n");
+    partOutput->verbose(CALL_INFO, 1, 0, "- Component Count:                  %10zu\n", pgraph->getNumComponents());
+    partOutput->verbose(CALL_INFO, 1, 0, "- Rank Count:                       %10" PRIu32 "\n", world_size.rank);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Thread Count:                     %10" PRIu32 "\n", world_size.thread);
+
+    vector<PartitionComponent*> comps;
+    Graph                       graph;
+    buildGraph(pgraph, comps, graph);
+    if ( comps.empty() ) return;
+
+    unordered_map<ComponentId_t, size_t> index;
+    for ( size_t v = 0; v < comps.size(); v++ )
+        index[comps[v]->id] = v;
+
+    // Each link once, and the distinct link latencies
+    vector<Edge>      edges;
+    vector<SimTime_t> latencies;
+    for ( size_t v = 0; v < comps.size(); v++ ) {
+        for ( LinkId_t id : comps[v]->links ) {
+            const PartitionLink& link = linkMap[id];
+            ComponentId_t other = link.component[0] == comps[v]->id ? link.component[1] : link.component[0];
+            size_t        u     = index[other];
+            if ( u <= v ) continue;
+            edges.push_back({ v, u, link.getMinLatency() });
+            latencies.push_back(link.getMinLatency());
+        }
+    }
+    std::sort(latencies.begin(), latencies.end());
+    latencies.erase(std::unique(latencies.begin(), latencies.end()), latencies.end());
+
+    // Find the largest latency threshold that still balances.  Merging
+    // more components can only make balancing harder, so a binary
+    // search over the latencies is used.
+    vector<uint32_t> ranks(comps.size(), 0);
+    if ( world_size.rank > 1 ) {
+        const double allowed = std::max(1.0 + rank_imbalance_tolerance, rankPartition(graph, edges, 0, ranks));
+
+        // The first latency merges nothing, which was done above
+        size_t lo = 0;
+        size_t hi = latencies.empty() ? 0 : latencies.size() - 1;
+        while ( lo < hi ) {
+            size_t           mid = (lo + hi + 1) / 2;
+            vector<uint32_t> trial(comps.size(), 0);
+            double           imbalance = rankPartition(graph, edges, latencies[mid], trial);
+            partOutput->verbose(
+                CALL_INFO, 2, 0, "Merging links below %" PRIu64 " gives imbalance %lg\n", latencies[mid], imbalance);
+            if ( imbalance <= allowed ) {
+                lo = mid;
+                ranks.swap(trial);
+            }
+            else {
+                hi = mid - 1;
+            }
+        }
+        if ( lo > 0 )
+            partOutput->verbose(
+                CALL_INFO, 1, 0, "- Links Not Cut Below Latency:      %10" PRIu64 "\n", latencies[lo]);
+    }
+
+    // Split each rank into threads
+    vector<uint32_t> threads(comps.size(), 0);
+    for ( uint32_t r = 0; r < world_size.rank; r++ ) {
+        vector<size_t> ids;
+        Graph          sub = extractPart(graph, ranks, r, ids);
+        recursiveBisect(sub, ids, 0, world_size.thread, threads);
+    }
+
+    for ( size_t v = 0; v < comps.size(); v++ ) {
+        comps[v]->rank = RankInfo(ranks[v], threads[v]);
+    }
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Latency aware partition scheme completed.\n");
+}
+
+double
+SSTLatencyPartition::rankPartition(
+    const Graph& graph, const vector<Edge>& edges, SimTime_t threshold, vector<uint32_t>& ranks)
+{
+    const size_t n = graph.size();
+
+    vector<size_t> root(n);
+    std::iota(root.begin(), root.end(), 0);
+    for ( const Edge& edge : edges ) {
+        if ( edge.latency >= threshold ) continue;
+        size_t a = findRoot(root, edge.u);
+        size_t b = findRoot(root, edge.v);
+        if ( a != b ) root[std::max(a, b)] = std::min(a, b);
+    }
+
+    // Number the merged vertices in order of their lowest vertex
+    vector<size_t> cmap(n);
+    size_t         nc = 0;
+    for ( size_t v = 0; v < n; v++ ) {
+        size_t r = findRoot(root, v);
+        cmap[v]  = r == v ? nc++ : cmap[r];
+    }
+    Graph merged = contract(graph, cmap, nc);
+
+    const double total = std::accumulate(graph.vwgt.begin(), graph.vwgt.end(), 0.0);
+    const double limit = (1.0 + rank_imbalance_tolerance) * total / world_size.rank;
+
+    // A merged vertex that is too heavy for one rank can not be balanced
+    if ( nc < n ) {
+        double heaviest = *std::max_element(merged.vwgt.begin(), merged.vwgt.end());
+        if ( heaviest > limit && heaviest > *std::max_element(graph.vwgt.begin(), graph.vwgt.end()) )
+            return heaviest * world_size.rank / total;
+    }
+
+    vector<size_t> ids(nc);
+    std::iota(ids.begin(), ids.end(), 0);
+    vector<uint32_t> parts(nc, 0);
+    recursiveBisect(merged, ids, 0, world_size.rank, parts);
+
+    vector<double> weight(world_size.rank, 0.0);
+    for ( size_t v = 0; v < n; v++ ) {
+        ranks[v] = parts[cmap[v]];
+        weight[ranks[v]] += graph.vwgt[v];
+    }
+    return *std::max_element(weight.begin(), weight.end()) * world_size.rank / total;
+}
@@ -0,0 +1,87 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_LATENCY_H
+#define SST_CORE_IMPL_PARTITONERS_LATENCY_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/impl/partitioners/multilevel.h"
+#include "sst/core/sst_types.h"
+
+#include <vector>
+
+namespace SST {
+namespace IMPL {
+namespace Partition {
+
+/**
+Partitioner that maximizes the minimum latency of the links cut
+between ranks, since that latency sets the period of the rank syncs.
+
+Links below a latency threshold are treated as links that can not be
+cut: the components they connect are merged before the graph is split
+into ranks.  The largest threshold whose merged graph can still be
+split within the imbalance tolerance is found by a binary search over
+the link latencies.  The merged graph is split into ranks, and each
+rank into threads, with the multilevel partitioner.
+*/
+class SSTLatencyPartition : public SSTMultilevelPartition
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTLatencyPartition,
+        "sst",
+        "latency",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Multilevel partitioner that maximizes the minimum latency of the links cut between ranks, within a load balance tolerance.")
+
+    /**
+       Creates a new latency aware partition scheme.
+       \param total_ranks Number of ranks and threads in the simulation
+       \param my_rank Rank of this process
+       \param verbosity The level of information to output
+    */
+    SSTLatencyPartition(RankInfo total_ranks, RankInfo my_rank, int verbosity);
+
+    /**
+       Performs a partition of an SST simulation configuration
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(PartitionGraph* graph) override;
+
+    void setImbalanceTolerance(double tolerance) override { rank_imbalance_tolerance = tolerance; }
+
+private:
+    // Allowed ratio of the heaviest rank to the average, above what
+    // the partition with no merged components achieves.  Set with
+    // --imbalance-tolerance.
+    double rank_imbalance_tolerance;
+
+    struct Edge
+    {
+        size_t    u;
+        size_t    v;
+        SimTime_t latency;
+    };
+
+    // Split the graph into ranks after merging the components joined
+    // by links with a latency below threshold.  Returns the ratio of
+    // the heaviest rank to the average.
+    double
+    rankPartition(const Graph& graph, const std::vector<Edge>& edges, SimTime_t threshold, std::vector<uint32_t>& ranks);
+};
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_PARTITONERS_LATENCY_H
@@ -0,0 +1,514 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/multilevel.h"
+
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <deque>
+#include <limits>
+#include <numeric>
+#include <set>
+#include <unordered_map>
+
+using namespace std;
+using namespace SST::IMPL::Partition;
+
+// Stop coarsening once a graph has this many vertices
+static const size_t coarsen_to = 100;
+// Stop coarsening if a level removes less than this fraction of the
+// vertices
+static const double min_coarsen_ratio = 0.05;
+// Number of seeds tried for the initial bisection
+static const int initial_tries = 8;
+// Maximum number of refinement passes at each level
+static const int refine_passes = 8;
+
+static const size_t unmatched = std::numeric_limits<size_t>::max();
+
+typedef SSTMultilevelPartition::Graph Graph;
+
+static double
+cutWeight(const Graph& graph, const vector<uint8_t>& side)
+{
+    double cut = 0.0;
+    for ( size_t v = 0; v < graph.size(); v++ ) {
+        for ( size_t e = graph.xadj[v]; e < graph.xadj[v + 1]; e++ ) {
+            if ( side[v] != side[graph.adjncy[e]] ) cut += graph.adjwgt[e];
+        }
+    }
+    // Each edge was counted from both ends
+    return cut / 2.0;
+}
+
+static double
+maxVertexWeight(const Graph& graph)
+{
+    double max = 0.0;
+    for ( double w : graph.vwgt )
+        if ( w > max ) max = w;
+    return max;
+}
+
+// Amount by which the sides are heavier than allowed
+static double
+violation(const double weight[2], const double max_weight[2])
+{
+    return std::max(0.0, weight[0] - max_weight[0]) + std::max(0.0, weight[1] - max_weight[1]);
+}
+
+SSTMultilevelPartition::SSTMultilevelPartition(RankInfo total_ranks, RankInfo UNUSED(my_rank), int verbosity) :
+    world_size(total_ranks),
+    imbalance_tolerance(0.03),
+    rng(1)
+{
+    partOutput = new Output("MultilevelPartition ", verbosity, 0, SST::Output::STDOUT);
+}
+
+SSTMultilevelPartition::~SSTMultilevelPartition()
+{
+    delete partOutput;
+}
+
+void
+SSTMultilevelPartition::performPartition(PartitionGraph* pgraph)
+{
+    const uint32_t num_parts = world_size.rank * world_size.thread;
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a multilevel partition scheme for simulation model.\n");
+    partOutput->verbose(CALL_INFO, 1, 0, "- Component Count:                  %10zu\n", pgraph->getNumComponents());
+    partOutput->verbose(CALL_INFO, 1, 0, "- Part Count:                       %10" PRIu32 "\n", num_parts);
+
+    vector<PartitionComponent*> comps;
+    Graph                       graph;
+    buildGraph(pgraph, comps, graph);
+
+    vector<size_t> ids(comps.size());
+    std::iota(ids.begin(), ids.end(), 0);
+    vector<uint32_t> parts(comps.size(), 0);
+    recursiveBisect(graph, ids, 0, num_parts, parts);
+
+    for ( size_t v = 0; v < comps.size(); v++ ) {
+        comps[v]->rank = RankInfo(parts[v] / world_size.thread, parts[v] % world_size.thread);
+    }
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Multilevel partition scheme completed.\n");
+}
+
+void
+SSTMultilevelPartition::buildGraph(PartitionGraph* pgraph, vector<PartitionComponent*>& comps, Graph& graph)
+{
+    PartitionComponentMap_t& compMap = pgraph->getComponentMap();
+    PartitionLinkMap_t&      linkMap = pgraph->getLinkMap();
+
+    // Build the CSR graph.  Parallel links between two components are
+    // combined into a single edge.
+    unordered_map<ComponentId_t, size_t> index;
+    double                               total_weight = 0.0;
+    for ( PartitionComponentMap_t::iterator it = compMap.begin(); it != compMap.end(); ++it ) {
+        index[(*it)->id] = comps.size();
+        comps.push_back(*it);
+        graph.vwgt.push_back((*it)->weight);
+        total_weight += (*it)->weight;
+    }
+    // Balance on component count if no weights were given
+    if ( total_weight <= 0.0 ) std::fill(graph.vwgt.begin(), graph.vwgt.end(), 1.0);
+
+    vector<size_t> pos(comps.size(), unmatched);
+    graph.xadj.push_back(0);
+    for ( size_t v = 0; v < comps.size(); v++ ) {
+        size_t start = graph.adjncy.size();
+        for ( LinkId_t id : comps[v]->links ) {
+            const PartitionLink& link  = linkMap[id];
+            ComponentId_t        other = link.component[0] == comps[v]->id ? link.component[1] : link.component[0];
+            if ( other == comps[v]->id ) continue;
+
+            size_t u = index[other];
+            // Low latency links are the most expensive to cut
+            double w = 1.0 / std::max(link.getMinLatency(), (SimTime_t)1);
+            if ( pos[u] == unmatched ) {
+                pos[u] = graph.adjncy.size();
+                graph.adjncy.push_back(u);
+                graph.adjwgt.push_back(w);
+            }
+            else {
+                graph.adjwgt[pos[u]] += w;
+            }
+        }
+        for ( size_t e = start; e < graph.adjncy.size(); e++ )
+            pos[graph.adjncy[e]] = unmatched;
+        graph.xadj.push_back(graph.adjncy.size());
+    }
+}
+
+void
+SSTMultilevelPartition::recursiveBisect(
+    const Graph& graph, const vector<size_t>& ids, uint32_t first_part, uint32_t num_parts, vector<uint32_t>& parts)
+{
+    if ( num_parts == 1 || graph.size() == 0 ) {
+        for ( size_t v = 0; v < graph.size(); v++ )
+            parts[ids[v]] = first_part;
+        return;
+    }
+
+    const uint32_t  num_parts0 = (num_parts + 1) / 2;
+    vector<uint8_t> side       = bisect(graph, (double)num_parts0 / num_parts);
+    vector<size_t>  local(graph.size());
+    vector<size_t>  count(2, 0);
+    for ( size_t v = 0; v < graph.size(); v++ )
+        local[v] = count[side[v]]++;
+
+    // Extract the subgraph for each side, dropping the cut edges
+    for ( uint8_t s = 0; s < 2; s++ ) {
+        Graph          sub;
+        vector<size_t> sub_ids;
+        sub.xadj.push_back(0);
+        for ( size_t v = 0; v < graph.size(); v++ ) {
+            if ( side[v] != s ) continue;
+            sub.vwgt.push_back(graph.vwgt[v]);
+            sub_ids.push_back(ids[v]);
+            for ( size_t e = graph.xadj[v]; e < graph.xadj[v + 1]; e++ ) {
+                size_t u = graph.adjncy[e];
+                if ( side[u] != s ) continue;
+                sub.adjncy.push_back(local[u]);
+                sub.adjwgt.push_back(graph.adjwgt[e]);
+            }
+            sub.xadj.push_back(sub.adjncy.size());
+        }
+
+        if ( s == 0 )
+            recursiveBisect(sub, sub_ids, first_part, num_parts0, parts);
+        else
+            recursiveBisect(sub, sub_ids, first_part + num_parts0, num_parts - num_parts0, parts);
+    }
+}
+
+vector<uint8_t>
+SSTMultilevelPartition::bisect(const Graph& graph, double frac0)
+{
+    const double total     = std::accumulate(graph.vwgt.begin(), graph.vwgt.end(), 0.0);
+    const double target[2] = { total * frac0, total - total * frac0 };
+
+    // Coarsen the graph.  Limit the coarse vertex weights so the
+    // coarsest graph can still be balanced.
+    deque<Graph>          levels;
+    deque<vector<size_t>> cmaps;
+    const Graph*          current  = &graph;
+    const double          max_vwgt = 1.5 * total / coarsen_to;
+    while ( current->size() > coarsen_to ) {
+        vector<size_t> cmap;
+        Graph          coarse = coarsen(*current, cmap, max_vwgt);
+        if ( coarse.size() > (1.0 - min_coarsen_ratio) * current->size() ) break;
+        levels.push_back(std::move(coarse));
+        cmaps.push_back(std::move(cmap));
+        current = &levels.back();
+    }
+
+    partOutput->verbose(
+        CALL_INFO, 2, 0, "Bisecting %zu vertices, coarsened to %zu vertices in %zu levels\n", graph.size(),
+        current->size(), levels.size());
+
+    // Allow each side to be heavier than the target by the tolerance.
+    // The coarser levels may also be off by one vertex, since their
+    // vertices are too heavy to balance exactly.
+    auto maxWeights = [&](const Graph& g, double max_weight[2]) {
+        double slack = &g == &graph ? 0.0 : maxVertexWeight(g);
+        for ( int s = 0; s < 2; s++ )
+            max_weight[s] = std::max(target[s] * (1.0 + imbalance_tolerance), target[s] + slack);
+    };
+
+    // Initial bisection of the coarsest graph, keeping the best of
+    // several seeds
+    vector<uint8_t> side;
+    {
+        double max_weight[2];
+        maxWeights(*current, max_weight);
+
+        double best_cut       = 0.0;
+        double best_violation = std::numeric_limits<double>::max();
+        for ( int i = 0; i < initial_tries; i++ ) {
+            vector<uint8_t> trial;
+            growBisection(*current, rng() % current->size(), target, trial);
+            double cut = refine(*current, max_weight, trial);
+
+            double weight[2] = { 0.0, 0.0 };
+            for ( size_t v = 0; v < current->size(); v++ )
+                weight[trial[v]] += current->vwgt[v];
+            double viol = violation(weight, max_weight);
+
+            if ( viol < best_violation || (viol == best_violation && cut < best_cut) ) {
+                best_violation = viol;
+                best_cut       = cut;
+                side.swap(trial);
+            }
+        }
+    }
+
+    // Project back to the original graph, refining at each level
+    while ( !levels.empty() ) {
+        levels.pop_back();
+        const Graph&    finer = levels.empty() ? graph : levels.back();
+        vector<size_t>& cmap  = cmaps.back();
+
+        vector<uint8_t> projected(finer.size());
+        for ( size_t v = 0; v < finer.size(); v++ )
+            projected[v] = side[cmap[v]];
+        side.swap(projected);
+        cmaps.pop_back();
+
+        double max_weight[2];
+        maxWeights(finer, max_weight);
+        refine(finer, max_weight, side);
+    }
+
+    return side;
+}
+
+Graph
+SSTMultilevelPartition::coarsen(const Graph& graph, vector<size_t>& cmap, double max_vwgt)
+{
+    const size_t n = graph.size();
+
+    // Heavy edge matching, visiting the vertices in random order
+    vector<size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), rng);
+
+    vector<size_t> match(n, unmatched);
+    for ( size_t v : order ) {
+        if ( match[v] != unmatched ) continue;
+
+        size_t best   = v;
+        double best_w = -1.0;
+        for ( size_t e = graph.xadj[v]; e < graph.xadj[v + 1]; e++ ) {
+            size_t u = graph.adjncy[e];
+            if ( match[u] != unmatched || graph.vwgt[v] + graph.vwgt[u] > max_vwgt ) continue;
+            if ( graph.adjwgt[e] > best_w ) {
+                best   = u;
+                best_w = graph.adjwgt[e];
+            }
+        }
+        match[v]    = best;
+        match[best] = v;
+    }
+
+    // Number the coarse vertices in order of their lowest fine vertex
+    cmap.assign(n, unmatched);
+    size_t nc = 0;
+    for ( size_t v = 0; v < n; v++ ) {
+        if ( cmap[v] != unmatched ) continue;
+        cmap[v] = cmap[match[v]] = nc++;
+    }
+    return contract(graph, cmap, nc);
+}
+
+Graph
+SSTMultilevelPartition::contract(const Graph& graph, const vector<size_t>& cmap, size_t nc)
+{
+    const size_t n = graph.size();
+
+    // List the fine vertices of each coarse vertex
+    vector<size_t> first(nc + 1, 0);
+    for ( size_t v = 0; v < n; v++ )
+        first[cmap[v] + 1]++;
+    for ( size_t c = 0; c < nc; c++ )
+        first[c + 1] += first[c];
+    vector<size_t> members(n);
+    {
+        vector<size_t> next(first.begin(), first.end() - 1);
+        for ( size_t v = 0; v < n; v++ )
+            members[next[cmap[v]]++] = v;
+    }
+
+    Graph coarse;
+    coarse.vwgt.assign(nc, 0.0);
+    coarse.xadj.push_back(0);
+    vector<size_t> pos(nc, unmatched);
+    for ( size_t c = 0; c < nc; c++ ) {
+        size_t start = coarse.adjncy.size();
+        for ( size_t i = first[c]; i < first[c + 1]; i++ ) {
+            size_t f = members[i];
+            coarse.vwgt[c] += graph.vwgt[f];
+            for ( size_t e = graph.xadj[f]; e < graph.xadj[f + 1]; e++ ) {
+                size_t u = cmap[graph.adjncy[e]];
+                if ( u == c ) continue;
+                if ( pos[u] == unmatched ) {
+                    pos[u] = coarse.adjncy.size();
+                    coarse.adjncy.push_back(u);
+                    coarse.adjwgt.push_back(graph.adjwgt[e]);
+                }
+                else {
+                    coarse.adjwgt[pos[u]] += graph.adjwgt[e];
+                }
+            }
+        }
+        for ( size_t e = start; e < coarse.adjncy.size(); e++ )
+            pos[coarse.adjncy[e]] = unmatched;
+        coarse.xadj.push_back(coarse.adjncy.size());
+    }
+    return coarse;
+}
+
+void
+SSTMultilevelPartition::growBisection(const Graph& graph, size_t seed, const double target[2], vector<uint8_t>& side)
+{
+    const size_t n = graph.size();
+    side.assign(n, 1);
+
+    // Gain of moving each vertex from side 1 to side 0
+    vector<double> gain(n, 0.0);
+    for ( size_t v = 0; v < n; v++ )
+        for ( size_t e = graph.xadj[v]; e < graph.xadj[v + 1]; e++ )
+            gain[v] -= graph.adjwgt[e];
+
+    set<pair<double, size_t>> frontier;
+    vector<bool>              in_frontier(n, false);
+    frontier.insert(make_pair(gain[seed], seed));
+    in_frontier[seed] = true;
+
+    double weight0 = 0.0;
+    size_t next    = 0;
+    while ( weight0 < target[0] ) {
+        if ( frontier.empty() ) {
+            // Disconnected graph, start again from any vertex still
+            // on side 1
+            while ( next < n && side[next] == 0 )
+                next++;
+            if ( next == n ) break;
+            frontier.insert(make_pair(gain[next], next));
+            in_frontier[next] = true;
+        }
+
+        auto   it = std::prev(frontier.end());
+        size_t v  = it->second;
+        frontier.erase(it);
+        in_frontier[v] = false;
+
+        // Stop if adding this vertex would overshoot by more than it
+        // falls short
+        if ( weight0 > 0.0 && weight0 + graph.vwgt[v] - target[0] > target[0] - weight0 ) break;
+
+        side[v] = 0;
+        weight0 += graph.vwgt[v];
+        for ( size_t e = graph.xadj[v]; e < graph.xadj[v + 1]; e++ ) {
+            size_t u = graph.adjncy[e];
+            if ( side[u] == 0 ) continue;
+            if ( in_frontier[u] ) frontier.erase(make_pair(gain[u], u));
+            gain[u] += 2.0 * graph.adjwgt[e];
+            frontier.insert(make_pair(gain[u], u));
+            in_frontier[u] = true;
+        }
+    }
+}
+
+double
+SSTMultilevelPartition::refine(const Graph& graph, const double max_weight[2], vector<uint8_t>& side)
+{
+    const size_t n = graph.size();
+
+    double weight[2] = { 0.0, 0.0 };
+    for ( size_t v = 0; v < n; v++ )
+        weight[side[v]] += graph.vwgt[v];
+
+    double cut = cutWeight(graph, side);
+
+    // Give up on a pass after this many moves without improvement
+    const size_t limit = std::max((size_t)50, n / 100);
+    // Moves may make a side too heavy by up to one vertex, so that a
+    // later move in the other direction can restore the balance.  Only
+    // the balanced states are kept.
+    const double slack = maxVertexWeight(graph);
+
+    vector<double> gain(n);
+    vector<bool>   locked(n);
+    vector<size_t> moves;
+    for ( int pass = 0; pass < refine_passes; pass++ ) {
+        // Gain of moving each vertex to the other side
+        set<pair<double, size_t>> queue[2];
+        for ( size_t v = 0; v < n; v++ ) {
+            gain[v] = 0.0;
+            for ( size_t e = graph.xadj[v]; e < graph.xadj[v + 1]; e++ )
+                gain[v] += side[graph.adjncy[e]] != side[v] ? graph.adjwgt[e] : -graph.adjwgt[e];
+            queue[side[v]].insert(make_pair(gain[v], v));
+        }
+        std::fill(locked.begin(), locked.end(), false);
+        moves.clear();
+
+        double current_cut    = cut;
+        double best_cut       = cut;
+        double best_violation = violation(weight, max_weight);
+        size_t best_moves     = 0;
+        size_t since_best     = 0;
+        while ( since_best < limit ) {
+            // Take the best move from either side that does not make
+            // the other side too heavy, unless this side is already
+            // too heavy
+            int from = -1;
+            for ( int s = 0; s < 2; s++ ) {
+                if ( queue[s].empty() ) continue;
+                const auto& top = *queue[s].rbegin();
+                if ( weight[1 - s] + graph.vwgt[top.second] > max_weight[1 - s] + slack &&
+                     weight[s] <= max_weight[s] )
+                    continue;
+                if ( from == -1 || top.first > queue[from].rbegin()->first ) from = s;
+            }
+            if ( from == -1 ) break;
+
+            auto   it = std::prev(queue[from].end());
+            size_t v  = it->second;
+            queue[from].erase(it);
+            locked[v] = true;
+
+            side[v] = 1 - from;
+            weight[from] -= graph.vwgt[v];
+            weight[1 - from] += graph.vwgt[v];
+            current_cut -= gain[v];
+            moves.push_back(v);
+
+            for ( size_t e = graph.xadj[v]; e < graph.xadj[v + 1]; e++ ) {
+                size_t u = graph.adjncy[e];
+                if ( locked[u] ) continue;
+                queue[side[u]].erase(make_pair(gain[u], u));
+                gain[u] += side[u] == from ? 2.0 * graph.adjwgt[e] : -2.0 * graph.adjwgt[e];
+                queue[side[u]].insert(make_pair(gain[u], u));
+            }
+
+            double viol = violation(weight, max_weight);
+            if ( viol < best_violation || (viol == best_violation && current_cut < best_cut) ) {
+                best_violation = viol;
+                best_cut       = current_cut;
+                best_moves     = moves.size();
+                since_best     = 0;
+            }
+            else {
+                since_best++;
+            }
+        }
+
+        // Undo the moves after the best point
+        for ( size_t i = moves.size(); i > best_moves; i-- ) {
+            size_t v = moves[i - 1];
+            weight[side[v]] -= graph.vwgt[v];
+            side[v] = 1 - side[v];
+            weight[side[v]] += graph.vwgt[v];
+        }
+        cut = best_cut;
+
+        if ( best_moves == 0 ) break;
+    }
+    return cut;
+}
@@ -0,0 +1,127 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_MULTILEVEL_H
+#define SST_CORE_IMPL_PARTITONERS_MULTILEVEL_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/sstpart.h"
+
+#include <random>
+#include <vector>
+
+namespace SST {
+
+class Output;
+class PartitionComponent;
+
+namespace IMPL {
+namespace Partition {
+
+/**
+Performs a multilevel partition of an SST simulation configuration.
+The graph is split into the required number of parts by recursive
+bisection.  Each bisection coarsens the graph using heavy edge
+matching, bisects the coarsest graph by greedy graph growing and then
+projects the bisection back to the original graph, refining it with
+Fiduccia-Mattheyses passes at each level.
+
+Edges are weighted by the inverse of the link latency, so low latency
+links are the most expensive to cut, and parts are balanced on the
+component weights.
+*/
+class SSTMultilevelPartition : public SST::Partition::SSTPartitioner
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTMultilevelPartition,
+        "sst",
+        "multilevel",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Multilevel partitioner that minimizes the cut of low latency links while balancing component weights.")
+
+    /**
+       Creates a new multilevel partition scheme.
+       \param total_ranks Number of ranks and threads in the simulation
+       \param my_rank Rank of this process
+       \param verbosity The level of information to output
+    */
+    SSTMultilevelPartition(RankInfo total_ranks, RankInfo my_rank, int verbosity);
+    ~SSTMultilevelPartition();
+
+    /**
+       Performs a partition of an SST simulation configuration
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(PartitionGraph* graph) override;
+
+    bool requiresConfigGraph() override { return false; }
+    bool spawnOnAllRanks() override { return false; }
+
+    void setImbalanceTolerance(double tolerance) override { imbalance_tolerance = tolerance; }
+
+    /** Graph in compressed sparse row format */
+    struct Graph
+    {
+        std::vector<double> vwgt;   // vertex weights
+        std::vector<size_t> xadj;   // offset of each vertex's edges
+        std::vector<size_t> adjncy; // edge endpoints
+        std::vector<double> adjwgt; // edge weights
+
+        size_t size() const { return vwgt.size(); }
+    };
+
+protected:
+    /** Number of ranks in the simulation */
+    RankInfo world_size;
+    /** Output object to print partitioning information */
+    Output*  partOutput;
+    /** Allowed imbalance of each side of a bisection, or of each part
+     * for label propagation.  Set with --imbalance-tolerance. */
+    double   imbalance_tolerance;
+
+    std::mt19937 rng;
+
+    // Build the graph of the components, filling in comps with the
+    // component for each vertex
+    void buildGraph(PartitionGraph* pgraph, std::vector<PartitionComponent*>& comps, Graph& graph);
+
+    // Split the graph into num_parts parts, numbered from first_part.
+    // ids gives the index in parts for each vertex.
+    void recursiveBisect(
+        const Graph& graph, const std::vector<size_t>& ids, uint32_t first_part, uint32_t num_parts,
+        std::vector<uint32_t>& parts);
+
+    // Returns side (0 or 1) for each vertex, with side 0 getting
+    // frac0 of the total weight
+    std::vector<uint8_t> bisect(const Graph& graph, double frac0);
+
+    // Match vertices and return the coarser graph.  cmap is filled in
+    // with the coarse vertex for each vertex.
+    Graph coarsen(const Graph& graph, std::vector<size_t>& cmap, double max_vwgt);
+
+    // Merge the vertices of graph into the nc vertices given by cmap
+    Graph contract(const Graph& graph, const std::vector<size_t>& cmap, size_t nc);
+
+    // Greedy graph growing from a seed vertex
+    void growBisection(const Graph& graph, size_t seed, const double target[2], std::vector<uint8_t>& side);
+
+    // Fiduccia-Mattheyses refinement.  Returns the cut weight.
+    double refine(const Graph& graph, const double max_weight[2], std::vector<uint8_t>& side);
+};
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_PARTITONERS_MULTILEVEL_H
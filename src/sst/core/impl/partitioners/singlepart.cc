@@ -28,6 +28,6 @@ SSTSinglePartition::performPartition(ConfigGraph* graph)
     ConfigComponentMap_t& compMap = graph->getComponentMap();
 
     for ( auto comp : compMap ) {
-        comp->rank = RankInfo(0, 0);
+        comp->setRank(RankInfo(0, 0));
     }
 }
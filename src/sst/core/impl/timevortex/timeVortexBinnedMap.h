@@ -141,6 +141,8 @@ public:
     void print(Output& out) const override;
 
     uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t takeQueueOrder() override { return insertOrder++; }
+    bool     supportsQueueOrder() const override { return true; }
     uint64_t getMaxDepth() const override { return max_depth; }
 
 private:
@@ -0,0 +1,138 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexFifo.h"
+
+#include "sst/core/output.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+namespace SST {
+namespace IMPL {
+
+TimeVortexFifo::TimeVortexFifo(TimeVortex* tv) : TimeVortex(), tv(tv), fifo_depth(0), fifo_max_depth(0) {}
+
+TimeVortexFifo::~TimeVortexFifo()
+{
+    for ( auto& bucket : buckets ) {
+        for ( size_t i = bucket.next; i < bucket.activities.size(); i++ ) {
+            delete bucket.activities[i];
+        }
+    }
+    delete tv;
+}
+
+bool
+TimeVortexFifo::empty()
+{
+    return buckets.empty() && tv->empty();
+}
+
+int
+TimeVortexFifo::size()
+{
+    return tv->size() + fifo_depth;
+}
+
+void
+TimeVortexFifo::insertNewTime(Activity* activity)
+{
+    SimTime_t time = activity->getDeliveryTime();
+
+    // Events for earlier times than the latest FIFO come from links
+    // with shorter latencies, so search from the back
+    auto it = buckets.end();
+    while ( it != buckets.begin() && std::prev(it)->time > time ) {
+        --it;
+    }
+    if ( it != buckets.begin() && std::prev(it)->time == time ) {
+        addToBucket(*std::prev(it), activity);
+        return;
+    }
+
+    Bucket bucket;
+    bucket.time   = time;
+    bucket.next   = 0;
+    bucket.sorted = true;
+    if ( !spare.empty() ) {
+        bucket.activities.swap(spare.back());
+        spare.pop_back();
+    }
+    bucket.activities.push_back(activity);
+    buckets.insert(it, std::move(bucket));
+}
+
+TimeVortexFifo::Bucket&
+TimeVortexFifo::frontBucket()
+{
+    Bucket& bucket = buckets.front();
+    if ( !bucket.sorted ) {
+        std::stable_sort(bucket.activities.begin() + bucket.next, bucket.activities.end(), Activity::less<false, true, true>());
+        bucket.sorted = true;
+    }
+    return bucket;
+}
+
+Activity*
+TimeVortexFifo::popBucket()
+{
+    Bucket&   bucket   = buckets.front();
+    Activity* activity = bucket.activities[bucket.next++];
+    if ( bucket.next == bucket.activities.size() ) {
+        bucket.activities.clear();
+        spare.push_back(std::move(bucket.activities));
+        buckets.pop_front();
+    }
+    fifo_depth--;
+    return activity;
+}
+
+Activity*
+TimeVortexFifo::pop()
+{
+    if ( buckets.empty() ) return tv->pop();
+
+    Bucket&   bucket = frontBucket();
+    Activity* fifo   = bucket.activities[bucket.next];
+    if ( !tv->empty() && !Activity::less<true, true, true>()(fifo, tv->front()) ) return tv->pop();
+    return popBucket();
+}
+
+Activity*
+TimeVortexFifo::front()
+{
+    if ( buckets.empty() ) return tv->front();
+
+    Bucket&   bucket = frontBucket();
+    Activity* fifo   = bucket.activities[bucket.next];
+    if ( !tv->empty() ) {
+        Activity* other = tv->front();
+        if ( !Activity::less<true, true, true>()(fifo, other) ) return other;
+    }
+    return fifo;
+}
+
+void
+TimeVortexFifo::print(Output& out) const
+{
+    tv->print(out);
+    out.output("Link FIFOs:\n");
+    for ( auto& bucket : buckets ) {
+        out.output(
+            "  time %" PRIu64 ": %zu events\n", (uint64_t)bucket.time, bucket.activities.size() - bucket.next);
+    }
+}
+
+} // namespace IMPL
+} // namespace SST
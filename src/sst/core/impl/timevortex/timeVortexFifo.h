@@ -0,0 +1,121 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXFIFO_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXFIFO_H
+
+#include "sst/core/activity.h"
+#include "sst/core/timeVortex.h"
+
+#include <deque>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Puts per-timestamp FIFOs in front of another TimeVortex.  Used
+ * with --fifo-links.
+ *
+ * Links within a thread add the events they send with no extra delay
+ * with insertFifo().  Since time only moves forward and each link
+ * has a fixed latency, these events arrive for a handful of
+ * timestamps, mostly the latest one, and are appended to the FIFO for
+ * their timestamp.  A FIFO is only sorted by priority and link order
+ * tag if the events did not arrive in that order, and it is merged
+ * with the TimeVortex as it is popped.  Everything else goes to the
+ * TimeVortex.
+ *
+ * The order of delivery is the same as if all the events were in the
+ * TimeVortex.  Events added to a FIFO take their queue order from the
+ * TimeVortex's insertion count, so ties on time, priority and tag are
+ * broken by the order the events were sent in, wherever they are.
+ * Both directions of a link share a tag, so such ties can come from
+ * different links.
+ */
+class TimeVortexFifo : public TimeVortex
+{
+
+public:
+    /** The TimeVortex is deleted with this object */
+    TimeVortexFifo(TimeVortex* tv);
+    ~TimeVortexFifo();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override { tv->insert(activity); }
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    /** Sum of the largest depths of the TimeVortex and the FIFOs, so
+     * it can be larger than the actual largest depth */
+    uint64_t getMaxDepth() const override { return tv->getMaxDepth() + fifo_max_depth; }
+    uint64_t getCurrentDepth() const override { return tv->getCurrentDepth() + fifo_depth; }
+    uint64_t takeQueueOrder() override { return tv->takeQueueOrder(); }
+    bool     supportsQueueOrder() const override { return tv->supportsQueueOrder(); }
+
+    /** Add an activity to the FIFO for its delivery time.  Must only
+     * be called by the thread that owns the TimeVortex. */
+    inline void insertFifo(Activity* activity)
+    {
+        activity->setQueueOrder(tv->takeQueueOrder());
+        if ( !buckets.empty() && buckets.back().time == activity->getDeliveryTime() ) {
+            addToBucket(buckets.back(), activity);
+        }
+        else {
+            insertNewTime(activity);
+        }
+        if ( ++fifo_depth > fifo_max_depth ) fifo_max_depth = fifo_depth;
+    }
+
+private:
+    struct Bucket
+    {
+        SimTime_t              time;
+        size_t                 next; // First activity not yet popped
+        bool                   sorted;
+        std::vector<Activity*> activities;
+    };
+
+    inline void addToBucket(Bucket& bucket, Activity* activity)
+    {
+        if ( bucket.sorted && bucket.activities.size() > bucket.next &&
+             Activity::less<false, true, true>()(activity, bucket.activities.back()) ) {
+            bucket.sorted = false;
+        }
+        bucket.activities.push_back(activity);
+    }
+
+    void      insertNewTime(Activity* activity);
+    Bucket&   frontBucket();
+    Activity* popBucket();
+
+    TimeVortex* tv;
+
+    // FIFOs in order of time
+    std::deque<Bucket> buckets;
+    // Storage from FIFOs that were emptied, reused for new ones
+    std::vector<std::vector<Activity*>> spare;
+
+    uint64_t fifo_depth;
+    uint64_t fifo_max_depth;
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXFIFO_H
@@ -0,0 +1,219 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexKeyedHeap.h"
+
+#include "sst/core/clock.h"
+#include "sst/core/output.h"
+
+#include <cinttypes>
+#include <cstring>
+#include <new>
+
+namespace SST {
+namespace IMPL {
+
+// Two cache lines, which holds one group of four siblings
+static constexpr std::align_val_t heap_alignment = std::align_val_t(128);
+
+template <bool TS>
+TimeVortexKeyedHeapBase<TS>::TimeVortexKeyedHeapBase(Params& params) :
+    TimeVortex(),
+    heap(nullptr),
+    end(root),
+    capacity(0),
+    insertOrder(0),
+    current_depth(0)
+{
+    max_depth = 0;
+
+    size_t initial = params.find<size_t>("initial_size", 1024);
+    if ( initial < 1 ) initial = 1;
+    capacity = initial + root;
+    heap     = static_cast<Entry*>(::operator new(capacity * sizeof(Entry), heap_alignment));
+}
+
+template <bool TS>
+TimeVortexKeyedHeapBase<TS>::~TimeVortexKeyedHeapBase()
+{
+    // Activities in the TimeVortex all need to be deleted
+    for ( size_t i = root; i < end; ++i ) {
+        delete heap[i].activity;
+    }
+    ::operator delete(heap, heap_alignment);
+}
+
+template <bool TS>
+void
+TimeVortexKeyedHeapBase<TS>::grow()
+{
+    size_t new_capacity = capacity * 2;
+    Entry* new_heap     = static_cast<Entry*>(::operator new(new_capacity * sizeof(Entry), heap_alignment));
+    std::memcpy(static_cast<void*>(new_heap + root), heap + root, (end - root) * sizeof(Entry));
+    ::operator delete(heap, heap_alignment);
+    heap     = new_heap;
+    capacity = new_capacity;
+}
+
+template <bool TS>
+bool
+TimeVortexKeyedHeapBase<TS>::empty()
+{
+    if ( TS ) slock.lock();
+    auto ret = end == root;
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+int
+TimeVortexKeyedHeapBase<TS>::size()
+{
+    if ( TS ) slock.lock();
+    auto ret = end - root;
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexKeyedHeapBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    activity->setQueueOrder(insertOrder++);
+
+    Entry entry;
+    entry.time = activity->getDeliveryTime();
+    // Rebuild the combined priority/order tag value used by
+    // Activity::greater
+    entry.priority_order = ((uint64_t)(uint32_t)activity->getPriority() << 32) | activity->getOrderTag();
+    entry.queue_order    = activity->getQueueOrder();
+    entry.activity       = activity;
+
+    if ( UNLIKELY(end == capacity) ) grow();
+
+    // Sift up, moving parents down into the hole until the new entry
+    // fits
+    size_t index = end++;
+    while ( index > root ) {
+        size_t p = parent(index);
+        if ( !(entry < heap[p]) ) break;
+        heap[index] = heap[p];
+        index       = p;
+    }
+    heap[index] = entry;
+
+    current_depth++;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexKeyedHeapBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    if ( end == root ) {
+        if ( TS ) slock.unlock();
+        return nullptr;
+    }
+    Activity* ret_val = heap[root].activity;
+
+    // Sift the last entry down from the root, moving the smallest
+    // child up into the hole at each level
+    end--;
+    if ( end > root ) {
+        const Entry& last  = heap[end];
+        size_t       index = root;
+        while ( true ) {
+            size_t child = firstChild(index);
+            if ( child >= end ) break;
+            size_t last_child = child + 4 < end ? child + 4 : end;
+            size_t min        = child;
+            for ( size_t c = child + 1; c < last_child; ++c ) {
+                if ( heap[c] < heap[min] ) min = c;
+            }
+            if ( !(heap[min] < last) ) break;
+            heap[index] = heap[min];
+            index       = min;
+        }
+        heap[index] = last;
+    }
+
+    current_depth--;
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexKeyedHeapBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    auto ret = end == root ? nullptr : heap[root].activity;
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexKeyedHeapBase<TS>::print(Output& out) const
+{
+    out.output("TimeVortex state:\n");
+    for ( size_t i = root; i < end; ++i ) {
+        out.output("  %s\n", heap[i].activity->toString().c_str());
+    }
+}
+
+class TimeVortexKeyedHeap : public TimeVortexKeyedHeapBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexKeyedHeap,
+        "sst",
+        "timevortex.keyed_heap",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex based on a cache aligned 4-ary heap that stores the sort key with each entry.")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "initial_size", "Number of entries to allocate space for initially", "1024" }
+    )
+
+    TimeVortexKeyedHeap(Params& params) : TimeVortexKeyedHeapBase<false>(params) {}
+    ~TimeVortexKeyedHeap() {}
+    SST_ELI_EXPORT(TimeVortexKeyedHeap)
+};
+
+class TimeVortexKeyedHeap_ts : public TimeVortexKeyedHeapBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexKeyedHeap_ts,
+        "sst",
+        "timevortex.keyed_heap.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Thread safe verion of TimeVortex based on a cache aligned 4-ary heap.  Do not reference this element directly, just specify sst.timevortex.keyed_heap and this version will be selected when it is needed based on other parameters.")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "initial_size", "Number of entries to allocate space for initially", "1024" }
+    )
+
+    TimeVortexKeyedHeap_ts(Params& params) : TimeVortexKeyedHeapBase<true>(params) {}
+    ~TimeVortexKeyedHeap_ts() {}
+    SST_ELI_EXPORT(TimeVortexKeyedHeap_ts)
+};
+
+} // namespace IMPL
+} // namespace SST
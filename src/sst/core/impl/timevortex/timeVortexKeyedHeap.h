@@ -0,0 +1,105 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXKEYEDHEAP_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXKEYEDHEAP_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/timeVortex.h"
+
+#include <atomic>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * TimeVortex based on a 4-ary heap whose entries carry a copy of the
+ * sort key.  Sifting through the heap only ever reads the heap array,
+ * the Activity itself is not touched until it is popped.
+ *
+ * Each entry is 32 bytes.  The root is stored at index 3 of an array
+ * aligned to 128 bytes, which puts every group of four siblings in
+ * its own pair of cache lines.
+ */
+template <bool TS>
+class TimeVortexKeyedHeapBase : public TimeVortex
+{
+
+public:
+    TimeVortexKeyedHeapBase(Params& params);
+    ~TimeVortexKeyedHeapBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t takeQueueOrder() override
+    {
+        // Other threads can insert while the owning thread takes an
+        // order number, so share the lock with insert()
+        if ( TS ) slock.lock();
+        uint64_t ret = insertOrder++;
+        if ( TS ) slock.unlock();
+        return ret;
+    }
+    bool     supportsQueueOrder() const override { return true; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+    struct Entry
+    {
+        SimTime_t time;
+        uint64_t  priority_order;
+        uint64_t  queue_order;
+        Activity* activity;
+
+        inline bool operator<(const Entry& rhs) const
+        {
+            if ( time != rhs.time ) return time < rhs.time;
+            if ( priority_order != rhs.priority_order ) return priority_order < rhs.priority_order;
+            return queue_order < rhs.queue_order;
+        }
+    };
+
+    // Index of the root in the heap array
+    static constexpr size_t root = 3;
+
+    static inline size_t parent(size_t index) { return (index >> 2) + 2; }
+    static inline size_t firstChild(size_t index) { return (index << 2) - 8; }
+
+    void grow();
+
+    // Heap storage.  Entries live in [root, end)
+    Entry* heap;
+    size_t end;
+    size_t capacity;
+
+    uint64_t insertOrder;
+
+    // Need current depth to be atomic if we are thread safe
+    typename std::conditional<TS, std::atomic<uint64_t>, uint64_t>::type current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXKEYEDHEAP_H
@@ -0,0 +1,394 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexLadder.h"
+
+#include "sst/core/clock.h"
+#include "sst/core/output.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+namespace SST {
+namespace IMPL {
+
+// We sort backwards so we can work from the bottom of the vector
+// (faster delete)
+static Activity::greater<true, true, true> ladder_greater;
+
+template <bool TS>
+TimeVortexLadderBase<TS>::TimeVortexLadderBase(Params& params) :
+    TimeVortex(),
+    top_min(MAX_SIMTIME_T),
+    top_max(0),
+    top_last(0),
+    insertOrder(0),
+    current_depth(0)
+{
+    max_depth = 0;
+
+    bottom_threshold = params.find<uint64_t>("bottom_threshold", 50);
+    max_rungs        = params.find<uint64_t>("max_rungs", 8);
+    max_buckets      = params.find<uint64_t>("max_buckets", 65536);
+
+    if ( bottom_threshold < 1 ) bottom_threshold = 1;
+    if ( max_rungs < 1 ) max_rungs = 1;
+    if ( max_buckets < 2 ) max_buckets = 2;
+}
+
+template <bool TS>
+TimeVortexLadderBase<TS>::~TimeVortexLadderBase()
+{
+    // Activities in the TimeVortex all need to be deleted
+    for ( auto x : top ) {
+        delete x;
+    }
+    for ( auto r : rungs ) {
+        for ( auto& b : r->buckets ) {
+            for ( auto x : b ) {
+                delete x;
+            }
+        }
+        delete r;
+    }
+    for ( auto r : rung_pool ) {
+        delete r;
+    }
+    for ( auto x : bottom ) {
+        delete x;
+    }
+}
+
+template <bool TS>
+bool
+TimeVortexLadderBase<TS>::empty()
+{
+    return current_depth == 0;
+}
+
+template <bool TS>
+int
+TimeVortexLadderBase<TS>::size()
+{
+    return current_depth;
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    activity->setQueueOrder(insertOrder++);
+    current_depth++;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+
+    SimTime_t time = activity->getDeliveryTime();
+
+    // With no rungs, the top can take anything that sorts after
+    // everything currently in the bottom.
+    if ( rungs.empty() ) {
+        if ( bottom.empty() || time > bottom.front()->getDeliveryTime() ) {
+            top.push_back(activity);
+            if ( time < top_min ) top_min = time;
+            if ( time > top_max ) top_max = time;
+        }
+        else {
+            insertBottom(activity);
+        }
+        if ( TS ) slock.unlock();
+        return;
+    }
+
+    if ( time > top_last ) {
+        top.push_back(activity);
+        if ( time < top_min ) top_min = time;
+        if ( time > top_max ) top_max = time;
+        if ( TS ) slock.unlock();
+        return;
+    }
+
+    // Find the coarsest rung that has not already consumed the
+    // bucket this time falls into
+    for ( auto r : rungs ) {
+        // A rung that was split on its last bucket has no range left
+        if ( r->cur < r->num_buckets && time >= r->lowerBound() ) {
+            r->buckets[(time - r->start) / r->width].push_back(activity);
+            r->count++;
+            if ( TS ) slock.unlock();
+            return;
+        }
+    }
+
+    insertBottom(activity);
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::insertBottom(Activity* activity)
+{
+    if ( UNLIKELY(bottom.size() >= bottom_threshold) ) {
+        if ( rungs.empty() ) {
+            // Nothing below the top, so just hand everything back to
+            // the top and let the next pop build a new ladder sized
+            // to the current spread of times.
+            for ( auto x : bottom ) {
+                SimTime_t time = x->getDeliveryTime();
+                if ( time < top_min ) top_min = time;
+                if ( time > top_max ) top_max = time;
+            }
+            top.insert(top.end(), bottom.begin(), bottom.end());
+            bottom.clear();
+            SimTime_t time = activity->getDeliveryTime();
+            if ( time < top_min ) top_min = time;
+            if ( time > top_max ) top_max = time;
+            top.push_back(activity);
+            return;
+        }
+        if ( rungs.size() < max_rungs ) {
+            spawnRungFromBottom();
+            Rung* r = rungs.back();
+            if ( activity->getDeliveryTime() >= r->lowerBound() ) {
+                r->buckets[(activity->getDeliveryTime() - r->start) / r->width].push_back(activity);
+                r->count++;
+                return;
+            }
+        }
+    }
+
+    // Bottom is sorted in reverse order, so find the first element
+    // that is not greater than the new activity and insert before it
+    auto it = std::lower_bound(bottom.begin(), bottom.end(), activity, ladder_greater);
+    bottom.insert(it, activity);
+}
+
+template <bool TS>
+typename TimeVortexLadderBase<TS>::Rung*
+TimeVortexLadderBase<TS>::createRung(SimTime_t low, SimTime_t high, uint64_t count)
+{
+    Rung* r;
+    if ( rung_pool.empty() ) { r = new Rung(); }
+    else {
+        r = rung_pool.back();
+        rung_pool.pop_back();
+    }
+
+    // Size the buckets so that, on average, each one holds a single
+    // activity.  Careful to avoid overflow when the range covers all
+    // of SimTime_t.
+    uint64_t target = std::min(std::max(count, (uint64_t)2), max_buckets);
+    SimTime_t span  = high - low;
+    r->start        = low;
+    r->width        = span / target;
+    if ( r->width < MAX_SIMTIME_T ) r->width++;
+    r->num_buckets = span / r->width + 1;
+    r->cur         = 0;
+    r->count       = 0;
+    if ( r->buckets.size() < r->num_buckets ) r->buckets.resize(r->num_buckets);
+
+    rungs.push_back(r);
+    return r;
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::spawnRungFromBottom()
+{
+    // Everything in the bottom is earlier than the lower bound of
+    // the finest rung, so the new rung covers the bottom's earliest
+    // time up to that bound.
+    SimTime_t low  = bottom.back()->getDeliveryTime();
+    SimTime_t high = rungs.back()->lowerBound() - 1;
+
+    Rung* r = createRung(low, high, bottom.size());
+    for ( auto x : bottom ) {
+        r->buckets[(x->getDeliveryTime() - r->start) / r->width].push_back(x);
+    }
+    r->count = bottom.size();
+    bottom.clear();
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::releaseRung()
+{
+    rung_pool.push_back(rungs.back());
+    rungs.pop_back();
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::sortBottom()
+{
+    std::sort(bottom.begin(), bottom.end(), ladder_greater);
+}
+
+template <bool TS>
+bool
+TimeVortexLadderBase<TS>::fillBottom()
+{
+    while ( true ) {
+        if ( rungs.empty() ) {
+            if ( top.empty() ) return false;
+
+            // Build the first rung from the top
+            Rung* r = createRung(top_min, top_max, top.size());
+            for ( auto x : top ) {
+                r->buckets[(x->getDeliveryTime() - r->start) / r->width].push_back(x);
+            }
+            r->count = top.size();
+            top_last = top_max;
+            top.clear();
+            top_min = MAX_SIMTIME_T;
+            top_max = 0;
+        }
+
+        Rung* r = rungs.back();
+        if ( r->count == 0 ) {
+            // Everything in this rung has been handed to a finer rung
+            releaseRung();
+            continue;
+        }
+        while ( r->buckets[r->cur].empty() )
+            r->cur++;
+
+        bucket_t& bucket       = r->buckets[r->cur];
+        SimTime_t bucket_start = r->lowerBound();
+        r->cur++;
+        r->count -= bucket.size();
+
+        if ( bucket.size() > bottom_threshold && r->width > 1 && rungs.size() < max_rungs ) {
+            // Too many activities to sort, split the bucket into a
+            // finer rung.  The new rung starts at the earliest time in
+            // the bucket, but needs to cover the rest of the bucket's
+            // range since later inserts can land there.
+            SimTime_t low = MAX_SIMTIME_T;
+            for ( auto x : bucket ) {
+                if ( x->getDeliveryTime() < low ) low = x->getDeliveryTime();
+            }
+            SimTime_t high = bucket_start + (r->width - 1);
+            if ( MAX_SIMTIME_T - bucket_start < r->width - 1 ) high = MAX_SIMTIME_T;
+
+            Rung* child = createRung(low, high, bucket.size());
+            for ( auto x : bucket ) {
+                child->buckets[(x->getDeliveryTime() - child->start) / child->width].push_back(x);
+            }
+            child->count = bucket.size();
+            bucket.clear();
+            continue;
+        }
+
+        // Small enough to sort
+        bottom.swap(bucket);
+        while ( !rungs.empty() && rungs.back()->count == 0 )
+            releaseRung();
+        sortBottom();
+        return true;
+    }
+}
+
+template <bool TS>
+Activity*
+TimeVortexLadderBase<TS>::frontInternal()
+{
+    if ( bottom.empty() && !fillBottom() ) return nullptr;
+    return bottom.back();
+}
+
+template <bool TS>
+Activity*
+TimeVortexLadderBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    Activity* ret = frontInternal();
+    if ( ret != nullptr ) {
+        bottom.pop_back();
+        current_depth--;
+    }
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+Activity*
+TimeVortexLadderBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    Activity* ret = frontInternal();
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::print(Output& out) const
+{
+    out.output("TimeVortex state:\n");
+    out.output("  top: %zu activities\n", top.size());
+    for ( size_t i = 0; i < rungs.size(); ++i ) {
+        out.output(
+            "  rung %zu: %" PRIu64 " activities, %" PRIu64 " buckets of width %" PRIu64 " starting at %" PRIu64 "\n", i,
+            rungs[i]->count, rungs[i]->num_buckets - rungs[i]->cur, rungs[i]->width, rungs[i]->lowerBound());
+    }
+    out.output("  bottom: %zu activities\n", bottom.size());
+    for ( auto it = bottom.rbegin(); it != bottom.rend(); ++it ) {
+        out.output("    %s\n", (*it)->toString().c_str());
+    }
+}
+
+class TimeVortexLadder : public TimeVortexLadderBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexLadder,
+        "sst",
+        "timevortex.ladder",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex based on a ladder queue with adaptive bucket widths.")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "bottom_threshold", "Maximum number of activities sorted at once before a bucket is split into a finer rung", "50" },
+        { "max_rungs",        "Maximum number of rungs in the ladder", "8" },
+        { "max_buckets",      "Maximum number of buckets in a single rung", "65536" }
+    )
+
+    TimeVortexLadder(Params& params) : TimeVortexLadderBase<false>(params) {}
+    ~TimeVortexLadder() {}
+    SST_ELI_EXPORT(TimeVortexLadder)
+};
+
+class TimeVortexLadder_ts : public TimeVortexLadderBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexLadder_ts,
+        "sst",
+        "timevortex.ladder.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Thread safe verion of TimeVortex based on a ladder queue.  Do not reference this element directly, just specify sst.timevortex.ladder and this version will be selected when it is needed based on other parameters.")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "bottom_threshold", "Maximum number of activities sorted at once before a bucket is split into a finer rung", "50" },
+        { "max_rungs",        "Maximum number of rungs in the ladder", "8" },
+        { "max_buckets",      "Maximum number of buckets in a single rung", "65536" }
+    )
+
+    TimeVortexLadder_ts(Params& params) : TimeVortexLadderBase<true>(params) {}
+    ~TimeVortexLadder_ts() {}
+    SST_ELI_EXPORT(TimeVortexLadder_ts)
+};
+
+} // namespace IMPL
+} // namespace SST
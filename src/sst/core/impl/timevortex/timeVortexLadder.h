@@ -0,0 +1,134 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDER_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDER_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/timeVortex.h"
+
+#include <atomic>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * TimeVortex based on a ladder queue (Tang, Goh and Thng).
+ *
+ * Activities are kept in three tiers:
+ *
+ *  - top: an unsorted vector holding activities far in the future
+ *  - rungs: one or more levels of time buckets (unsorted vectors).
+ *    Each rung is built from the activities it receives, so the
+ *    bucket width adapts to the observed spread of delivery times.
+ *    Buckets holding more than bottom_threshold activities are
+ *    split into a finer rung before being consumed.
+ *  - bottom: a small vector kept sorted in reverse order that holds
+ *    the activities that will be delivered next.
+ *
+ * Only the bottom is ever sorted and the sort uses the full
+ * (delivery_time, priority_order, queue_order) key, so the order in
+ * which activities are returned is identical to TimeVortexPQ.
+ */
+template <bool TS>
+class TimeVortexLadderBase : public TimeVortex
+{
+
+public:
+    TimeVortexLadderBase(Params& params);
+    ~TimeVortexLadderBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t takeQueueOrder() override
+    {
+        // Other threads can insert while the owning thread takes an
+        // order number, so share the lock with insert()
+        if ( TS ) slock.lock();
+        uint64_t ret = insertOrder++;
+        if ( TS ) slock.unlock();
+        return ret;
+    }
+    bool     supportsQueueOrder() const override { return true; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+    typedef std::vector<Activity*> bucket_t;
+
+    // One level of the ladder
+    struct Rung
+    {
+        SimTime_t             start;
+        SimTime_t             width;
+        uint64_t              num_buckets;
+        // Index of the first bucket that has not been consumed
+        uint64_t              cur;
+        // Number of activities held in the rung
+        uint64_t              count;
+        std::vector<bucket_t> buckets;
+
+        // Smallest time that can still be inserted into this rung.
+        // Only valid when cur < num_buckets.
+        inline SimTime_t lowerBound() const { return start + (cur * width); }
+    };
+
+    void      insertBottom(Activity* activity);
+    Rung*     createRung(SimTime_t low, SimTime_t high, uint64_t count);
+    void      spawnRungFromBottom();
+    void      releaseRung();
+    bool      fillBottom();
+    void      sortBottom();
+    Activity* frontInternal();
+
+    // Tunables
+    uint64_t bottom_threshold;
+    uint64_t max_rungs;
+    uint64_t max_buckets;
+
+    // Top tier
+    bucket_t  top;
+    SimTime_t top_min;
+    SimTime_t top_max;
+    // Largest time that goes into the rungs rather than the top.
+    // Only valid when there is at least one rung.
+    SimTime_t top_last;
+
+    // Rungs, ordered from coarsest (rungs[0]) to finest
+    std::vector<Rung*> rungs;
+    std::vector<Rung*> rung_pool;
+
+    // Sorted in reverse order so the next activity is at the back
+    bucket_t bottom;
+
+    uint64_t insertOrder;
+
+    // Need current depth to be atomic if we are thread safe
+    typename std::conditional<TS, std::atomic<uint64_t>, uint64_t>::type current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDER_H
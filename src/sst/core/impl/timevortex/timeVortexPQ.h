@@ -47,6 +47,16 @@ public:
     void print(Output& out) const override;
 
     uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t takeQueueOrder() override
+    {
+        // Other threads can insert while the owning thread takes an
+        // order number, so share the lock with insert()
+        if ( TS ) slock.lock();
+        uint64_t ret = insertOrder++;
+        if ( TS ) slock.unlock();
+        return ret;
+    }
+    bool     supportsQueueOrder() const override { return true; }
     uint64_t getMaxDepth() const override { return max_depth; }
 
 private:
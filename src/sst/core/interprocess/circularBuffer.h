@@ -14,10 +14,35 @@
 
 #include "sstmutex.h"
 
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+// Blocked readers and writers sleep on a futex once they have spun
+// for a while.  Define SST_CORE_INTERPROCESS_NO_FUTEX to keep them
+// polling instead.
+#if defined(__linux__) && !defined(SST_CORE_INTERPROCESS_NO_FUTEX)
+#define SST_CORE_INTERPROCESS_FUTEX 1
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace SST {
 namespace Core {
 namespace Interprocess {
 
+/**
+ * Lock-free ring buffer between one writer and one reader, which can
+ * be in different processes when the buffer is in shared memory.
+ *
+ * The read and write indices only ever increase and are masked to
+ * find the slot, so the size of the buffer is rounded up to a power
+ * of two.  Each side keeps a copy of the other side's index and only
+ * reads the shared one when its copy says the buffer is empty (or
+ * full), and the two sides' data is kept on separate cache lines.
+ */
 template <typename T>
 class CircularBuffer
 {
@@ -25,97 +50,287 @@ class CircularBuffer
 public:
     CircularBuffer(size_t mSize = 0)
     {
-        buffSize   = mSize;
-        readIndex  = 0;
-        writeIndex = 0;
+        buffSize         = roundSize(mSize);
+        mask             = buffSize - 1;
+        readerWaiting    = 0;
+        writerWaiting    = 0;
+        dataSignal       = 0;
+        spaceSignal      = 0;
+        readIndex        = 0;
+        cachedWriteIndex = 0;
+        writeIndex       = 0;
+        cachedReadIndex  = 0;
     }
 
+    /**
+     * Number of entries a buffer asked to hold size entries uses, which
+     * is size rounded up to a power of two
+     */
+    static size_t roundSize(size_t size)
+    {
+        size_t result = 1;
+        while ( result < size ) {
+            result *= 2;
+        }
+        return size == 0 ? 0 : result;
+    }
+
+    /**
+     * Set the number of entries in the buffer.  Space must have been
+     * allocated after the buffer for roundSize(bufferSize) entries.
+     */
     bool setBufferSize(const size_t bufferSize)
     {
         if ( buffSize != 0 ) {
             fprintf(stderr, "Already specified size for buffer\n");
             return false;
         }
+        if ( bufferSize == 0 ) {
+            fprintf(stderr, "Buffer size must be at least 1\n");
+            return false;
+        }
 
-        buffSize = bufferSize;
+        buffSize = roundSize(bufferSize);
+        mask     = buffSize - 1;
         __sync_synchronize();
         return true;
     }
 
+    /** Read an entry, blocking until one is available */
     T read()
     {
+        T   result;
         int loop_counter = 0;
 
-        while ( true ) {
-            bufferMutex.lock();
+        while ( !readNB(&result) ) {
+            waitForData(loop_counter);
+        }
+        return result;
+    }
 
-            if ( readIndex != writeIndex ) {
-                const T result = buffer[readIndex];
-                readIndex      = (readIndex + 1) % buffSize;
+    bool readNB(T* result)
+    {
+        const size_t index = __atomic_load_n(&readIndex, __ATOMIC_RELAXED);
 
-                bufferMutex.unlock();
-                return result;
-            }
+        if ( index == cachedWriteIndex ) {
+            cachedWriteIndex = __atomic_load_n(&writeIndex, __ATOMIC_ACQUIRE);
+            if ( index == cachedWriteIndex ) return false;
+        }
 
-            bufferMutex.unlock();
-            bufferMutex.processorPause(loop_counter++);
+        *result = buffer[index & mask];
+        __atomic_store_n(&readIndex, index + 1, __ATOMIC_RELEASE);
+        wakeOther(&writerWaiting, &spaceSignal);
+        return true;
+    }
+
+    /**
+     * Read up to count entries, blocking until at least one is
+     * available
+     *
+     * @return Number of entries read
+     */
+    size_t readBatch(T* result, size_t count)
+    {
+        int loop_counter = 0;
+
+        if ( count == 0 ) return 0;
+        while ( true ) {
+            size_t num = readBatchNB(result, count);
+            if ( num > 0 ) return num;
+            waitForData(loop_counter);
         }
     }
 
-    bool readNB(T* result)
+    /**
+     * Read up to count entries that are already available
+     *
+     * @return Number of entries read
+     */
+    size_t readBatchNB(T* result, size_t count)
     {
-        if ( bufferMutex.try_lock() ) {
-            if ( readIndex != writeIndex ) {
-                *result   = buffer[readIndex];
-                readIndex = (readIndex + 1) % buffSize;
+        const size_t index = __atomic_load_n(&readIndex, __ATOMIC_RELAXED);
 
-                bufferMutex.unlock();
-                return true;
-            }
+        if ( cachedWriteIndex - index < count ) cachedWriteIndex = __atomic_load_n(&writeIndex, __ATOMIC_ACQUIRE);
+        size_t num = cachedWriteIndex - index;
+        if ( num > count ) num = count;
+        if ( num == 0 ) return 0;
 
-            bufferMutex.unlock();
+        for ( size_t i = 0; i < num; i++ ) {
+            result[i] = buffer[(index + i) & mask];
         }
-
-        return false;
+        __atomic_store_n(&readIndex, index + num, __ATOMIC_RELEASE);
+        wakeOther(&writerWaiting, &spaceSignal);
+        return num;
     }
 
+    /** Write an entry, blocking until there is space for it */
     void write(const T& v)
     {
         int loop_counter = 0;
 
-        while ( true ) {
-            bufferMutex.lock();
+        while ( !writeNB(v) ) {
+            waitForSpace(loop_counter);
+        }
+    }
+
+    bool writeNB(const T& v)
+    {
+        const size_t index = __atomic_load_n(&writeIndex, __ATOMIC_RELAXED);
 
-            if ( ((writeIndex + 1) % buffSize) != readIndex ) {
-                buffer[writeIndex] = v;
-                writeIndex         = (writeIndex + 1) % buffSize;
+        if ( index - cachedReadIndex == buffSize ) {
+            cachedReadIndex = __atomic_load_n(&readIndex, __ATOMIC_ACQUIRE);
+            if ( index - cachedReadIndex == buffSize ) return false;
+        }
 
-                __sync_synchronize();
-                bufferMutex.unlock();
-                return;
+        buffer[index & mask] = v;
+        __atomic_store_n(&writeIndex, index + 1, __ATOMIC_RELEASE);
+        wakeOther(&readerWaiting, &dataSignal);
+        return true;
+    }
+
+    /** Write count entries, blocking until there is space for all of them */
+    void writeBatch(const T* v, size_t count)
+    {
+        int loop_counter = 0;
+
+        while ( count > 0 ) {
+            size_t num = writeBatchNB(v, count);
+            if ( num == 0 ) {
+                waitForSpace(loop_counter);
+                continue;
             }
+            v += num;
+            count -= num;
+            loop_counter = 0;
+        }
+    }
+
+    /**
+     * Write as many of count entries as there is space for
+     *
+     * @return Number of entries written
+     */
+    size_t writeBatchNB(const T* v, size_t count)
+    {
+        const size_t index = __atomic_load_n(&writeIndex, __ATOMIC_RELAXED);
 
-            bufferMutex.unlock();
-            bufferMutex.processorPause(loop_counter++);
+        if ( buffSize - (index - cachedReadIndex) < count ) {
+            cachedReadIndex = __atomic_load_n(&readIndex, __ATOMIC_ACQUIRE);
         }
+        size_t num = buffSize - (index - cachedReadIndex);
+        if ( num > count ) num = count;
+        if ( num == 0 ) return 0;
+
+        for ( size_t i = 0; i < num; i++ ) {
+            buffer[(index + i) & mask] = v[i];
+        }
+        __atomic_store_n(&writeIndex, index + num, __ATOMIC_RELEASE);
+        wakeOther(&readerWaiting, &dataSignal);
+        return num;
     }
 
     ~CircularBuffer() {}
 
+    /** Drop all the entries in the buffer.  Must be called by the reader. */
     void clearBuffer()
     {
-        bufferMutex.lock();
-        readIndex = writeIndex;
-        __sync_synchronize();
-        bufferMutex.unlock();
+        // The reader's copy has to move too, or the entries between the
+        // old copy and the new read index would look readable
+        cachedWriteIndex = __atomic_load_n(&writeIndex, __ATOMIC_ACQUIRE);
+        __atomic_store_n(&readIndex, cachedWriteIndex, __ATOMIC_RELEASE);
+        wakeOther(&writerWaiting, &spaceSignal);
     }
 
 private:
-    SSTMutex bufferMutex;
-    size_t   buffSize;
-    size_t   readIndex;
-    size_t   writeIndex;
-    T        buffer[0];
+    // Number of times a blocked reader or writer polls before it
+    // sleeps.  SSTMutex::processorPause() starts yielding the processor
+    // part way through.
+    static constexpr int spin_limit = 256;
+
+    static constexpr size_t cache_line_size = 64;
+
+    void waitForData(int& loop_counter)
+    {
+#ifdef SST_CORE_INTERPROCESS_FUTEX
+        if ( loop_counter >= spin_limit ) {
+            sleepOn(&readerWaiting, &dataSignal, [this]() {
+                return __atomic_load_n(&writeIndex, __ATOMIC_SEQ_CST) == __atomic_load_n(&readIndex, __ATOMIC_RELAXED);
+            });
+            return;
+        }
+#endif
+        SSTMutex::processorPause(loop_counter++);
+    }
+
+    void waitForSpace(int& loop_counter)
+    {
+#ifdef SST_CORE_INTERPROCESS_FUTEX
+        if ( loop_counter >= spin_limit ) {
+            sleepOn(&writerWaiting, &spaceSignal, [this]() {
+                return __atomic_load_n(&writeIndex, __ATOMIC_RELAXED) - __atomic_load_n(&readIndex, __ATOMIC_SEQ_CST) ==
+                       buffSize;
+            });
+            return;
+        }
+#endif
+        SSTMutex::processorPause(loop_counter++);
+    }
+
+#ifdef SST_CORE_INTERPROCESS_FUTEX
+    // Sleep on signal until the other side changes it.  The waiting
+    // flag is set before blocked() is checked again, and the other side
+    // checks the flag after moving its index, so one of them always
+    // sees the other.
+    template <typename Blocked>
+    void sleepOn(uint32_t* waiting, uint32_t* signal, Blocked blocked)
+    {
+        const uint32_t value = __atomic_load_n(signal, __ATOMIC_ACQUIRE);
+        __atomic_store_n(waiting, 1, __ATOMIC_SEQ_CST);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        // The futex is shared between processes, so it can't be private
+        if ( blocked() ) syscall(SYS_futex, signal, FUTEX_WAIT, value, nullptr, nullptr, 0);
+        __atomic_store_n(waiting, 0, __ATOMIC_RELAXED);
+    }
+#endif
+
+    // Wake the other side if it is sleeping
+    void wakeOther(uint32_t* waiting, uint32_t* signal)
+    {
+#ifdef SST_CORE_INTERPROCESS_FUTEX
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if ( __atomic_load_n(waiting, __ATOMIC_RELAXED) ) {
+            __atomic_add_fetch(signal, 1, __ATOMIC_RELEASE);
+            syscall(SYS_futex, signal, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+        }
+#else
+        (void)waiting;
+        (void)signal;
+#endif
+    }
+
+    // Set once, then only read
+    size_t buffSize;
+    size_t mask;
+
+    // Only written when a side goes to sleep or is woken, so checking
+    // them doesn't pull in the other side's indices
+    uint32_t readerWaiting;
+    uint32_t writerWaiting;
+    uint32_t dataSignal;
+    uint32_t spaceSignal;
+    char     pad0[cache_line_size];
+
+    // Written by the reader
+    size_t readIndex;
+    size_t cachedWriteIndex;
+    char   pad1[cache_line_size];
+
+    // Written by the writer
+    size_t writeIndex;
+    size_t cachedReadIndex;
+    char   pad2[cache_line_size];
+
+    T buffer[0];
 };
 
 } // namespace Interprocess
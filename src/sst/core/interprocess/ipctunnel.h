@@ -113,7 +113,7 @@ public:
         sharedData       = shareResult.second;
 
         /* Construct the circular buffers */
-        const size_t cbSize = sizeof(MsgType) * bufferSize;
+        const size_t cbSize = sizeof(MsgType) * CircBuff_t::roundSize(bufferSize);
         for ( size_t c = 0; c < isd->numBuffers; c++ ) {
             CircBuff_t* cPtr = nullptr;
 
@@ -202,12 +202,39 @@ public:
     /** Blocks until space is available **/
     void writeMessage(size_t core, const MsgType& command) { circBuffs[core]->write(command); }
 
+    /** Non-blocking version of writeMessage, returns whether the command was written **/
+    bool writeMessageNB(size_t core, const MsgType& command) { return circBuffs[core]->writeNB(command); }
+
     /** Blocks until a command is available **/
     MsgType readMessage(size_t buffer) { return circBuffs[buffer]->read(); }
 
     /** Non-blocking version of readMessage **/
     bool readMessageNB(size_t buffer, MsgType* result) { return circBuffs[buffer]->readNB(result); }
 
+    /** Blocks until all the commands have been written **/
+    void writeMessageBatch(size_t core, const MsgType* commands, size_t count)
+    {
+        circBuffs[core]->writeBatch(commands, count);
+    }
+
+    /** Non-blocking version of writeMessageBatch, returns the number written **/
+    size_t writeMessageBatchNB(size_t core, const MsgType* commands, size_t count)
+    {
+        return circBuffs[core]->writeBatchNB(commands, count);
+    }
+
+    /** Blocks until at least one command is available, returns the number read **/
+    size_t readMessageBatch(size_t buffer, MsgType* result, size_t count)
+    {
+        return circBuffs[buffer]->readBatch(result, count);
+    }
+
+    /** Non-blocking version of readMessageBatch **/
+    size_t readMessageBatchNB(size_t buffer, MsgType* result, size_t count)
+    {
+        return circBuffs[buffer]->readBatchNB(result, count);
+    }
+
     /** Empty the messages in the buffer **/
     void clearBuffer(size_t core) { circBuffs[core]->clearBuffer(); }
 
@@ -225,11 +252,12 @@ private:
 
     size_t static calculateShmemSize(size_t numBuffers, size_t bufferSize)
     {
-        long page_size = sysconf(_SC_PAGESIZE);
+        long   page_size = sysconf(_SC_PAGESIZE);
+        size_t entries   = CircBuff_t::roundSize(bufferSize);
 
         /* Count how many pages are needed, at minimum */
         size_t isd    = 1 + ((sizeof(InternalSharedData) + (1 + numBuffers) * sizeof(size_t)) / page_size);
-        size_t buffer = 1 + ((sizeof(CircBuff_t) + bufferSize * sizeof(MsgType)) / page_size);
+        size_t buffer = 1 + ((sizeof(CircBuff_t) + entries * sizeof(MsgType)) / page_size);
         size_t shdata = 1 + ((sizeof(ShareDataType) + sizeof(InternalSharedData)) / page_size);
 
         /* Alloc 2 extra pages, just in case */
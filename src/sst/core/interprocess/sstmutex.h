@@ -28,7 +28,7 @@ class SSTMutex
 public:
     SSTMutex() { lockVal = SST_CORE_INTERPROCESS_UNLOCKED; }
 
-    void processorPause(int currentCount)
+    static void processorPause(int currentCount)
     {
         if ( currentCount < 64 ) {
 #if defined(__x86_64__)
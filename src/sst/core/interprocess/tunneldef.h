@@ -22,6 +22,7 @@
 
 #include "sst/core/interprocess/circularBuffer.h"
 
+#include <cstdlib>
 #include <inttypes.h>
 #include <unistd.h>
 #include <vector>
@@ -111,7 +112,7 @@ public:
             sharedData                                = bResult.second;
 
             // Reserve space for circular buffers
-            const size_t cbSize = sizeof(MsgType) * buffSize;
+            const size_t cbSize = sizeof(MsgType) * CircBuff_t::roundSize(buffSize);
             for ( size_t c = 0; c < isd->numBuffers; c++ ) {
                 CircBuff_t* cPtr = NULL;
 
@@ -170,6 +171,34 @@ public:
      */
     void writeMessage(size_t buffer, const MsgType& command) { circBuffs[buffer]->write(command); }
 
+    /** Write data to buffer, non-blocking
+     * @param buffer which buffer index to write to
+     * @param command message to write to buffer
+     * return whether the message was written
+     */
+    bool writeMessageNB(size_t buffer, const MsgType& command) { return circBuffs[buffer]->writeNB(command); }
+
+    /** Write several messages to buffer, blocks until they have all been written
+     * @param buffer which buffer index to write to
+     * @param commands messages to write to buffer
+     * @param count number of messages to write
+     */
+    void writeMessageBatch(size_t buffer, const MsgType* commands, size_t count)
+    {
+        circBuffs[buffer]->writeBatch(commands, count);
+    }
+
+    /** Write several messages to buffer, non-blocking
+     * @param buffer which buffer index to write to
+     * @param commands messages to write to buffer
+     * @param count number of messages to write
+     * return the number of messages that were written
+     */
+    size_t writeMessageBatchNB(size_t buffer, const MsgType* commands, size_t count)
+    {
+        return circBuffs[buffer]->writeBatchNB(commands, count);
+    }
+
     /** Read data from buffer, blocks until message received
      * @param buffer which buffer to read from
      * return the message
@@ -183,6 +212,28 @@ public:
      */
     bool readMessageNB(size_t buffer, MsgType* result) { return circBuffs[buffer]->readNB(result); }
 
+    /** Read several messages from buffer, blocks until at least one is received
+     * @param buffer which buffer to read from
+     * @param result array to return read messages in
+     * @param count maximum number of messages to read
+     * return the number of messages that were read
+     */
+    size_t readMessageBatch(size_t buffer, MsgType* result, size_t count)
+    {
+        return circBuffs[buffer]->readBatch(result, count);
+    }
+
+    /** Read several messages from buffer, non-blocking
+     * @param buffer which buffer to read from
+     * @param result array to return read messages in
+     * @param count maximum number of messages to read
+     * return the number of messages that were read
+     */
+    size_t readMessageBatchNB(size_t buffer, MsgType* result, size_t count)
+    {
+        return circBuffs[buffer]->readBatchNB(result, count);
+    }
+
     /** Empty the messages in a buffer
      * @param buffer which buffer to empty
      */
@@ -212,9 +263,10 @@ private:
     static size_t calculateShmemSize(size_t numBuffers, size_t bufferSize)
     {
         long   pagesize = sysconf(_SC_PAGESIZE);
+        size_t entries  = CircBuff_t::roundSize(bufferSize);
         /* Count how many pages are needed, at minimum */
         size_t isd      = 1 + ((sizeof(InternalSharedData) + (1 + numBuffers) * sizeof(size_t)) / pagesize);
-        size_t buffer   = 1 + ((sizeof(CircularBuffer<MsgType>) + bufferSize * sizeof(MsgType)) / pagesize);
+        size_t buffer   = 1 + ((sizeof(CircularBuffer<MsgType>) + entries * sizeof(MsgType)) / pagesize);
         size_t shdata   = 1 + ((sizeof(ShareDataType) + sizeof(InternalSharedData)) / pagesize);
 
         /* Alloc 2 extra pages just in case */
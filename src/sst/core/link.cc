@@ -15,6 +15,7 @@
 
 #include "sst/core/event.h"
 #include "sst/core/factory.h"
+#include "sst/core/impl/timevortex/timeVortexFifo.h"
 #include "sst/core/initQueue.h"
 #include "sst/core/pollingLinkQueue.h"
 #include "sst/core/profile/eventHandlerProfileTool.h"
@@ -76,6 +77,8 @@ private:
 
 Link::Link(LinkId_t tag) :
     send_queue(nullptr),
+    fifo_queue(nullptr),
+    untimed_pending(nullptr),
     delivery_info(0),
     defaultTimeBase(0),
     latency(1),
@@ -89,6 +92,8 @@ Link::Link(LinkId_t tag) :
 
 Link::Link() :
     send_queue(nullptr),
+    fifo_queue(nullptr),
+    untimed_pending(nullptr),
     delivery_info(0),
     defaultTimeBase(0),
     latency(1),
@@ -130,7 +135,13 @@ Link::finalizeConfiguration()
         pair_link->send_queue = nullptr;
     }
 
-    if ( HANDLER == type ) { pair_link->send_queue = Simulation_impl::getSimulation()->getTimeVortex(); }
+    if ( HANDLER == type ) {
+        pair_link->send_queue = Simulation_impl::getSimulation()->getTimeVortex();
+        // Sends from this thread can skip the TimeVortex's heap
+        if ( &pair_link->current_time == &current_time ) {
+            pair_link->fifo_queue = Simulation_impl::getSimulation()->getLinkFifo();
+        }
+    }
     else if ( POLL == type ) {
         pair_link->send_queue = new PollingLinkQueue();
     }
@@ -154,6 +165,7 @@ Link::prepareForComplete()
     if ( POLL == type ) { delete pair_link->send_queue; }
 
     pair_link->send_queue = nullptr;
+    pair_link->fifo_queue = nullptr;
 
     // If my pair link is a SYNC link, also need to call
     // prepareForComplete() on it
@@ -255,7 +267,10 @@ Link::send_impl(SimTime_t delay, Event* event)
 #endif
 
     if ( profile_tools ) profile_tools->eventSent(event);
-    send_queue->insert(event);
+    if ( fifo_queue != nullptr && delay == 0 )
+        fifo_queue->insertFifo(event);
+    else
+        send_queue->insert(event);
 }
 
 
@@ -268,12 +283,11 @@ Link::recv()
             CALL_INFO, 1, "Cannot call recv on a Link with an event handler installed (non-polling link.\n");
     }
 
-    Event*      event      = nullptr;
-    Simulation* simulation = Simulation_impl::getSimulation();
+    Event* event = nullptr;
 
     if ( !pair_link->send_queue->empty() ) {
         Activity* activity = pair_link->send_queue->front();
-        if ( activity->getDeliveryTime() <= simulation->getCurrentSimCycle() ) {
+        if ( activity->getDeliveryTime() <= current_time ) {
             event = static_cast<Event*>(activity);
             pair_link->send_queue->pop();
         }
@@ -285,15 +299,17 @@ void
 Link::sendUntimedData(Event* data)
 {
     if ( RUN == mode ) {
-        Simulation_impl::getSimulation()->getSimulationOutput().fatal(
+        Simulation_impl::getSimulationOutput().fatal(
             CALL_INFO, 1,
             "ERROR: Trying to call sendUntimedData/sendInitData or recvUntimedData/recvInitData during the run phase.");
     }
 
     if ( send_queue == nullptr ) { send_queue = new InitQueue(); }
-    Simulation_impl::getSimulation()->untimed_msg_count++;
-    data->setDeliveryTime(Simulation_impl::getSimulation()->untimed_phase + 1);
+    Simulation_impl* sim = Simulation_impl::getSimulation();
+    sim->untimed_msg_count++;
+    data->setDeliveryTime(sim->untimed_phase + 1);
     data->setDeliveryInfo(tag, delivery_info);
+    if ( pair_link->untimed_pending ) pair_link->untimed_pending[(sim->untimed_phase + 1) & 1] = true;
 
     send_queue->insert(data);
 #if __SST_DEBUG_EVENT_TRACKING__
@@ -307,6 +323,7 @@ void
 Link::sendUntimedData_sync(Event* data)
 {
     if ( send_queue == nullptr ) { send_queue = new InitQueue(); }
+    if ( pair_link->untimed_pending ) pair_link->untimed_pending[data->getDeliveryTime() & 1] = true;
 
     send_queue->insert(data);
 }
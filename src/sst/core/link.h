@@ -33,6 +33,10 @@ namespace Profile {
 class EventHandlerProfileTool;
 }
 
+namespace IMPL {
+class TimeVortexFifo;
+}
+
 /** Link between two components. Carries events */
 class alignas(64) Link
 {
@@ -225,6 +229,16 @@ protected:
     /** Queue of events to be received by the owning component */
     ActivityQueue* send_queue;
 
+    /** FIFOs that events sent with no extra delay are added to
+        instead of send_queue.  Only set with --fifo-links, and only
+        when the owning component is on the same thread as the
+        sender. */
+    IMPL::TimeVortexFifo* fifo_queue;
+
+    /** Flags of the owning Component that are set when untimed data
+        is sent to this link.  Only set with --untimed-quiescence. */
+    bool* untimed_pending;
+
     /** Holds the delivery information.  This is stored as a
       uintptr_t, but is actually a pointer converted using
       reinterpret_cast.  For links connected to a
@@ -48,17 +48,23 @@ REENABLE_WARNING
 #include "sst/core/threadsafe.h"
 #include "sst/core/timeLord.h"
 #include "sst/core/timeVortex.h"
+#include "sst/core/unitAlgebra.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <exception>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <map>
+#include <numeric>
 #include <signal.h>
+#include <sstream>
 #include <sys/resource.h>
 #include <time.h>
 
 // Configuration Graph Generation Options
+#include "sst/core/cfgoutput/binaryConfigOutput.h"
 #include "sst/core/cfgoutput/dotConfigOutput.h"
 #include "sst/core/cfgoutput/jsonConfigOutput.h"
 #include "sst/core/cfgoutput/pythonConfigOutput.h"
@@ -72,6 +78,10 @@ using namespace SST;
 
 static SST::Output g_output;
 
+// Maximum number of components in each chunk of the graph streamed
+// from rank 0 to the other ranks
+static const size_t graph_chunk_size = 4096;
+
 
 // Functions to force initialization stages of simulation to execute
 // one rank at a time.  Put force_rank_sequential_start() before the
@@ -200,6 +210,122 @@ dump_partition(Config& cfg, ConfigGraph* graph, const RankInfo& size)
     }
 }
 
+// Print the number of links cut, the imbalance and the minimum latency
+// across partitions so partitioners can be compared
+static void
+report_partition(Config& cfg, ConfigGraph* graph, const RankInfo& size)
+{
+    if ( !cfg.verbose() || size.rank * size.thread == 1 ) return;
+
+    ConfigComponentMap_t& comps = graph->getComponentMap();
+    ConfigLinkMap_t&      links = graph->getLinkMap();
+
+    std::vector<double> weight(size.rank * size.thread, 0.0);
+    double              total_weight = 0.0;
+    for ( ConfigComponentMap_t::iterator iter = comps.begin(); iter != comps.end(); ++iter ) {
+        weight[(*iter)->rank.rank * size.thread + (*iter)->rank.thread] += (*iter)->weight;
+        total_weight += (*iter)->weight;
+    }
+    double max_weight = *std::max_element(weight.begin(), weight.end());
+    double imbalance  = total_weight > 0.0 ? max_weight * weight.size() / total_weight : 1.0;
+
+    // Number of links cut at each latency, between ranks and between
+    // threads of the same rank
+    std::map<SimTime_t, std::pair<uint64_t, uint64_t>> histogram;
+
+    uint64_t  cut_links  = 0;
+    uint64_t  rank_links = 0;
+    SimTime_t min_part   = MAX_SIMTIME_T;
+    SimTime_t min_rank   = MAX_SIMTIME_T;
+    for ( ConfigLinkMap_t::iterator iter = links.begin(); iter != links.end(); ++iter ) {
+        ConfigLink* clink = *iter;
+        RankInfo    rank0 = comps[COMPONENT_ID_MASK(clink->component[0])]->rank;
+        RankInfo    rank1 = comps[COMPONENT_ID_MASK(clink->component[1])]->rank;
+        if ( rank0 == rank1 ) continue;
+        cut_links++;
+        min_part = std::min(min_part, clink->getMinLatency());
+        if ( rank0.rank == rank1.rank ) {
+            histogram[clink->getMinLatency()].second++;
+            continue;
+        }
+        histogram[clink->getMinLatency()].first++;
+        rank_links++;
+        min_rank = std::min(min_rank, clink->getMinLatency());
+    }
+
+    g_output.verbose(
+        CALL_INFO, 1, 0, "# Partition cut %" PRIu64 " of %zu links (%" PRIu64 " between ranks)\n", cut_links,
+        links.size(), rank_links);
+    g_output.verbose(CALL_INFO, 1, 0, "# Partition imbalance (max / average weight): %lg\n", imbalance);
+    if ( cut_links > 0 ) g_output.verbose(CALL_INFO, 1, 0, "# Minimum cut latency: %" PRIu64 "\n", min_part);
+    if ( rank_links > 0 )
+        g_output.verbose(CALL_INFO, 1, 0, "# Minimum cut latency between ranks: %" PRIu64 "\n", min_rank);
+
+    if ( histogram.empty() ) return;
+
+    // The ranks sync every min_rank, so show how many syncs each
+    // simulated microsecond will cost
+    UnitAlgebra time_base = Simulation_impl::getTimeLord()->getTimeBase();
+    g_output.verbose(CALL_INFO, 1, 0, "# Cut link latencies (between ranks / between threads):\n");
+    for ( auto& bucket : histogram ) {
+        g_output.verbose(
+            CALL_INFO, 1, 0, "#   %12s: %10" PRIu64 " / %10" PRIu64 "\n",
+            (time_base * bucket.first).toStringBestSI().c_str(), bucket.second.first, bucket.second.second);
+    }
+    if ( rank_links > 0 ) {
+        g_output.verbose(
+            CALL_INFO, 1, 0, "# Rank syncs per simulated microsecond: %lg\n",
+            1.0e-6 / (time_base.getDoubleValue() * min_rank));
+    }
+}
+
+#ifdef SST_CONFIG_HAVE_MPI
+// Move the components of a parallel loaded graph to the ranks the
+// partitioner gave them.  owned lists the components this rank loaded
+// and key_names has the parameter key names of each rank.  The ranks
+// exchange chunks in a shift, sending to the rank shift above and
+// receiving from the rank shift below, so only one chunk is in flight
+// from each rank at a time.
+static ConfigGraph*
+migrate_graph(
+    ConfigGraph* graph, const std::vector<ComponentId_t>& owned, const std::vector<std::vector<std::string>>& key_names,
+    const RankInfo& myRank, const RankInfo& world_size)
+{
+    std::vector<std::vector<ComponentId_t>> moving(world_size.rank);
+    for ( ComponentId_t id : owned ) {
+        moving[graph->findComponent(id)->rank.rank].push_back(id);
+    }
+
+    std::vector<ConfigGraph*> chunks;
+    for ( uint32_t shift = 0; shift < world_size.rank; shift++ ) {
+        uint32_t dest = (myRank.rank + shift) % world_size.rank;
+        uint32_t src  = (myRank.rank + world_size.rank - shift) % world_size.rank;
+
+        ConfigGraph* chunk    = graph->getChunk(dest, moving[dest], true, true);
+        ConfigGraph* received = new ConfigGraph();
+        if ( shift == 0 ) {
+            // Copy the components that stay, so the old graph can be
+            // freed
+            std::vector<char> buffer = Comms::serialize(*chunk);
+            Comms::deserialize(buffer, *received);
+        }
+        else {
+            Comms::sendrecv(dest, *chunk, src, *received, 0);
+            received->remapParamKeys(key_names[src]);
+        }
+        graph->releaseChunk(chunk);
+        chunks.push_back(received);
+    }
+
+    graph->clear();
+    delete graph;
+
+    ConfigGraph* new_graph = new ConfigGraph();
+    new_graph->addRankChunks(myRank.rank, chunks);
+    return new_graph;
+}
+#endif
+
 static void
 do_graph_wireup(ConfigGraph* graph, SST::Simulation_impl* sim, const RankInfo& myRank, SimTime_t min_part)
 {
@@ -301,18 +427,107 @@ doParallelCapableGraphOutput(SST::Config* cfg, ConfigGraph* graph, const RankInf
     // User asked us to dump the config graph in JSON format
     if ( cfg->output_json() != "" ) {
         std::string file_name(cfg->output_json());
-        if ( cfg->parallel_output() ) {
-            // Append rank number to base filename
+        if ( cfg->parallel_output() && !cfg->parallel_output_mode_multi() && world_size.rank != 1 ) {
+            // All the ranks write their part into the same file
+            JSONConfigGraphOutput out(file_name.c_str(), myRank.rank, world_size.rank);
+            out.generate(cfg, graph);
+        }
+        else {
+            if ( cfg->parallel_output() ) {
+                // Append rank number to base filename
+                std::string ext = addRankToFileName(file_name, myRank.rank);
+                if ( ext != ".json" ) {
+                    g_output.fatal(CALL_INFO, 1, "--output-json requires a filename with a .json extension\n");
+                }
+            }
+            JSONConfigGraphOutput out(file_name.c_str());
+            out.generate(cfg, graph);
+        }
+    }
+
+    // User asked us to dump the config graph in binary format
+    if ( cfg->output_binary() != "" ) {
+        std::string file_name(cfg->output_binary());
+        uint32_t    rank = BinaryConfigGraphOutput::ALL_RANKS;
+        if ( cfg->parallel_output() && world_size.rank != 1 ) {
+            // Append rank number to base filename and only write
+            // this rank's sections
             std::string ext = addRankToFileName(file_name, myRank.rank);
-            if ( ext != ".json" ) {
-                g_output.fatal(CALL_INFO, 1, "--output-json requires a filename with a .json extension\n");
+            if ( ext != ".sstb" ) {
+                g_output.fatal(CALL_INFO, 1, "--output-binary requires a filename with a .sstb extension\n");
             }
+            rank = myRank.rank;
         }
-        JSONConfigGraphOutput out(file_name.c_str());
+        BinaryConfigGraphOutput out(file_name.c_str(), rank);
         out.generate(cfg, graph);
     }
 }
 
+// Set the partitioning weight of the components listed in the file
+// written by --output-component-weights.  The weight is the handler
+// time in microseconds.  Components that were not timed get the
+// smallest measured weight.
+static void
+load_component_weights(Config& cfg, ConfigGraph* graph)
+{
+    if ( cfg.componentWeights() == "" ) return;
+
+    std::ifstream in(cfg.componentWeights());
+    if ( !in.is_open() ) {
+        g_output.fatal(CALL_INFO, 1, "Unable to open component weights file: %s\n", cfg.componentWeights().c_str());
+    }
+
+    std::map<std::string, float> weights;
+    float                        min_weight = 0.0;
+    std::string                  line;
+    while ( std::getline(in, line) ) {
+        if ( line.empty() || line[0] == '#' ) continue;
+        std::istringstream fields(line);
+        std::string        name;
+        uint64_t           time  = 0;
+        uint64_t           calls = 0;
+        if ( !(fields >> name >> time >> calls) ) {
+            g_output.fatal(
+                CALL_INFO, 1, "Invalid line in component weights file %s: %s\n", cfg.componentWeights().c_str(),
+                line.c_str());
+        }
+        float weight  = time / 1000.0;
+        weights[name] = weight;
+        if ( weight > 0.0 && (min_weight == 0.0 || weight < min_weight) ) min_weight = weight;
+    }
+    if ( min_weight == 0.0 ) min_weight = 1.0;
+
+    uint64_t              found = 0;
+    ConfigComponentMap_t& comps = graph->getComponentMap();
+    for ( ConfigComponentMap_t::iterator iter = comps.begin(); iter != comps.end(); ++iter ) {
+        auto it         = weights.find((*iter)->name);
+        (*iter)->weight = it != weights.end() && it->second > 0.0 ? it->second : min_weight;
+        if ( it != weights.end() ) found++;
+    }
+    g_output.verbose(
+        CALL_INFO, 1, 0, "# Loaded weights for %" PRIu64 " of %zu components from %s\n", found, comps.size(),
+        cfg.componentWeights().c_str());
+}
+
+// Set the type and wait policy for the thread barriers from the config
+static void
+setBarrierDefaults(const Config& cfg)
+{
+    using ThreadSafe::Barrier;
+
+    Barrier::Type type = cfg.barrier_type() == "tree" ? Barrier::Type::Tree : Barrier::Type::Central;
+
+    Barrier::WaitPolicy policy = Barrier::WaitPolicy::Sleep;
+    if ( cfg.barrier_wait() == "spin" )
+        policy = Barrier::WaitPolicy::Spin;
+    else if ( cfg.barrier_wait() == "yield" )
+        policy = Barrier::WaitPolicy::Yield;
+    else if ( cfg.barrier_wait() == "block" )
+        policy = Barrier::WaitPolicy::Block;
+
+    Barrier::setDefaults(type, policy);
+}
+
 typedef struct
 {
     RankInfo     myRank;
@@ -329,13 +544,90 @@ typedef struct
     uint64_t    current_tv_depth;
     uint64_t    sync_data_size;
 
+    // Handler time (ns) and calls of each component, for
+    // --output-component-weights
+    std::map<std::string, std::pair<uint64_t, uint64_t>> component_times;
+
 } SimThreadInfo_t;
 
+// Write the handler time of each component for
+// --output-component-weights and report how evenly the time was
+// spread across the ranks and threads
+static void
+write_component_weights(
+    Config& cfg, std::vector<SimThreadInfo_t>& threadInfo, const RankInfo& myRank, const RankInfo& world_size)
+{
+    if ( cfg.outputComponentWeights() == "" ) return;
+
+    std::map<std::string, std::pair<uint64_t, uint64_t>> times;
+    std::vector<double>                                  thread_time(world_size.thread, 0.0);
+    for ( uint32_t i = 0; i < world_size.thread; i++ ) {
+        for ( auto& x : threadInfo[i].component_times ) {
+            thread_time[i] += x.second.first / 1.0e9;
+            times[x.first].first += x.second.first;
+            times[x.first].second += x.second.second;
+        }
+    }
+
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( world_size.rank > 1 ) {
+        std::vector<double> all_time(myRank.rank == 0 ? world_size.rank * world_size.thread : 0);
+        MPI_Gather(
+            thread_time.data(), world_size.thread, MPI_DOUBLE, all_time.data(), world_size.thread, MPI_DOUBLE, 0,
+            MPI_COMM_WORLD);
+        thread_time.swap(all_time);
+
+        if ( myRank.rank == 0 ) {
+            for ( uint32_t r = 1; r < world_size.rank; r++ ) {
+                std::map<std::string, std::pair<uint64_t, uint64_t>> rank_times;
+                Comms::recv(r, 0, rank_times);
+                for ( auto& x : rank_times ) {
+                    times[x.first].first += x.second.first;
+                    times[x.first].second += x.second.second;
+                }
+            }
+        }
+        else {
+            Comms::send(0, 0, times);
+        }
+    }
+#endif
+
+    if ( myRank.rank != 0 ) return;
+
+    FILE* fp = fopen(cfg.outputComponentWeights().c_str(), "w");
+    if ( !fp ) {
+        g_output.fatal(
+            CALL_INFO, 1, "Unable to open component weights file: %s\n", cfg.outputComponentWeights().c_str());
+    }
+    fprintf(fp, "# Component, handler time (ns), handler calls\n");
+    for ( auto& x : times ) {
+        fprintf(fp, "%s %" PRIu64 " %" PRIu64 "\n", x.first.c_str(), x.second.first, x.second.second);
+    }
+    fclose(fp);
+
+    // Imbalance is the busiest thread (or rank) over the average
+    std::vector<double> rank_time(world_size.rank, 0.0);
+    for ( size_t i = 0; i < thread_time.size(); i++ )
+        rank_time[i / world_size.thread] += thread_time[i];
+
+    g_output.output("Component handler time (written to %s):\n", cfg.outputComponentWeights().c_str());
+    for ( auto* loads : { &rank_time, &thread_time } ) {
+        double total = std::accumulate(loads->begin(), loads->end(), 0.0);
+        double max   = *std::max_element(loads->begin(), loads->end());
+        double avg   = total / loads->size();
+        g_output.output(
+            "  %-8s max %f s, average %f s, imbalance %f\n", loads == &rank_time ? "Ranks:" : "Threads:", max, avg,
+            avg > 0.0 ? max / avg : 1.0);
+    }
+}
+
 static void
 start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier& barrier)
 {
     // Setup Mempools
     Core::MemPoolAccessor::initializeLocalData(tid);
+    Core::ThreadSafe::Barrier::setThreadIndex(tid);
     info.myRank.thread = tid;
     double start_build = sst_get_cpu_time();
 
@@ -507,6 +799,8 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
     info.max_tv_depth     = sim->getTimeVortexMaxDepth();
     info.current_tv_depth = sim->getTimeVortexCurrentDepth();
 
+    if ( info.config->outputComponentWeights() != "" ) sim->getComponentTimes(info.component_times);
+
     // Print the profiling info.  For threads, we will serialize
     // writing and for ranks we will use different files, unless we
     // are writing to console, in which case we will serialize the
@@ -688,6 +982,12 @@ main(int argc, char* argv[])
         CALL_INFO, 1, 0, "#main() My rank is (%u.%u), on %u/%u nodes/threads\n", myRank.rank, myRank.thread,
         world_size.rank, world_size.thread);
 
+    // The model can set options without the checks made when parsing
+    // the command line
+    if ( cfg.shared_memory_ranks() && cfg.per_peer_lookahead() ) {
+        g_output.fatal(CALL_INFO, 1, "ERROR: --shared-memory-ranks and --per-peer-lookahead cannot be used together\n");
+    }
+
     // Delete the model generator
     if ( modelGen ) {
         delete modelGen;
@@ -748,6 +1048,8 @@ main(int argc, char* argv[])
     ////// Start Partitioning //////
     double start_part = sst_get_cpu_time();
 
+    if ( myRank.rank == 0 || cfg.parallel_load() ) load_component_weights(cfg, graph);
+
     if ( !cfg.parallel_load() ) {
         // Normal partitioning
 
@@ -757,6 +1059,7 @@ main(int argc, char* argv[])
 
         // Get the partitioner.  Built in partitioners are in the "sst" library.
         SSTPartitioner* partitioner = factory->CreatePartitioner(cfg.partitioner(), world_size, myRank, cfg.verbose());
+        partitioner->setImbalanceTolerance(cfg.imbalance_tolerance());
 
         try {
             if ( partitioner->requiresConfigGraph() ) { partitioner->performPartition(graph); }
@@ -782,6 +1085,32 @@ main(int argc, char* argv[])
 
         delete partitioner;
     }
+    else {
+        // Each rank only has its own part of a parallel loaded graph,
+        // so only partitioners that can refine it in place are used
+        SSTPartitioner* partitioner = factory->CreatePartitioner(cfg.partitioner(), world_size, myRank, cfg.verbose());
+        if ( partitioner->supportsParallelLoad() ) {
+            partitioner->setImbalanceTolerance(cfg.imbalance_tolerance());
+            try {
+#ifdef SST_CONFIG_HAVE_MPI
+                std::vector<ComponentId_t> owned;
+                if ( world_size.rank > 1 ) owned = graph->getComponentIdsByRank(world_size.rank)[myRank.rank];
+#endif
+                partitioner->performParallelPartition(graph);
+#ifdef SST_CONFIG_HAVE_MPI
+                if ( world_size.rank > 1 ) {
+                    std::vector<std::vector<std::string>> key_names;
+                    Comms::all_gather(Params::keyMapReverse, key_names);
+                    graph = migrate_graph(graph, owned, key_names, myRank, world_size);
+                }
+#endif
+            }
+            catch ( std::exception& e ) {
+                g_output.fatal(CALL_INFO, -1, "Error encountered during graph partitioning phase: %s\n", e.what());
+            }
+        }
+        delete partitioner;
+    }
 
     // Check the partitioning to make sure it is sane
     if ( myRank.rank == 0 || cfg.parallel_load() ) {
@@ -795,11 +1124,16 @@ main(int argc, char* argv[])
     if ( myRank.rank == 0 ) {
         if ( !cfg.parallel_load() )
             g_output.verbose(CALL_INFO, 1, 0, "# Graph partitioning took %lg seconds.\n", (end_part - start_part));
+        const uint64_t graph_rss = post_graph_create_rss - pre_graph_create_rss;
+        const size_t   num_comps = graph->getNumComponents();
         g_output.verbose(
-            CALL_INFO, 1, 0, "# Graph construction and partition raised RSS by %" PRIu64 " KB\n",
-            (post_graph_create_rss - pre_graph_create_rss));
+            CALL_INFO, 1, 0,
+            "# Graph construction and partition raised RSS by %" PRIu64 " KB (%" PRIu64 " bytes per component)\n",
+            graph_rss, num_comps == 0 ? 0 : graph_rss * 1024 / num_comps);
         g_output.verbose(CALL_INFO, 1, 0, "# ------------------------------------------------------------\n");
 
+        if ( !cfg.parallel_load() ) report_partition(cfg, graph, world_size);
+
         // Output the partition information if user requests it
         dump_partition(cfg, graph, world_size);
     }
@@ -859,6 +1193,7 @@ main(int argc, char* argv[])
     }
 
     ////// Broadcast Graph //////
+    double start_graph_dist = sst_get_cpu_time();
 #ifdef SST_CONFIG_HAVE_MPI
     if ( world_size.rank > 1 && !cfg.parallel_load() ) {
         try {
@@ -867,53 +1202,46 @@ main(int argc, char* argv[])
             Comms::broadcast(Params::nextKeyID, 0);
             Comms::broadcast(Params::global_params, 0);
 
-            std::set<uint32_t> my_ranks;
-            std::set<uint32_t> your_ranks;
-
+            // Rank 0 streams each rank its own part of the graph in
+            // chunks, so no rank has to hold more than its own part
             if ( 0 == myRank.rank ) {
-                // Split the rank space in half
-                for ( uint32_t i = 0; i < world_size.rank / 2; i++ ) {
-                    my_ranks.insert(i);
+                std::vector<std::vector<ComponentId_t>> rank_ids = graph->getComponentIdsByRank(world_size.rank);
+                for ( uint32_t dest = 1; dest < world_size.rank; dest++ ) {
+                    const std::vector<ComponentId_t>& ids = rank_ids[dest];
+
+                    // Always send one chunk to carry the statistic configuration
+                    uint64_t num_chunks = (ids.size() + graph_chunk_size - 1) / graph_chunk_size;
+                    num_chunks          = std::max<uint64_t>(num_chunks, 1);
+                    Comms::send(dest, 0, num_chunks);
+                    for ( uint64_t i = 0; i < num_chunks; i++ ) {
+                        size_t                     first = std::min<size_t>(ids.size(), i * graph_chunk_size);
+                        size_t                     last  = std::min<size_t>(ids.size(), first + graph_chunk_size);
+                        std::vector<ComponentId_t> chunk_ids(ids.begin() + first, ids.begin() + last);
+
+                        ConfigGraph* chunk = graph->getChunk(dest, chunk_ids, i == 0);
+                        Comms::send(dest, 0, *chunk);
+                        graph->releaseChunk(chunk);
+                    }
                 }
 
-                for ( uint32_t i = world_size.rank / 2; i < world_size.rank; i++ ) {
+                // Keep only rank 0's part
+                std::set<uint32_t> my_ranks   = { 0 };
+                std::set<uint32_t> your_ranks;
+                for ( uint32_t i = 1; i < world_size.rank; i++ ) {
                     your_ranks.insert(i);
                 }
-
-                // Need to send the your_ranks set and the proper
-                // subgraph for further distribution
-                // ConfigGraph* your_graph = graph->getSubGraph(your_ranks);
-                ConfigGraph* your_graph = graph->splitGraph(my_ranks, your_ranks);
-                int          dest       = *your_ranks.begin();
-                Comms::send(dest, 0, your_ranks);
-                Comms::send(dest, 0, *your_graph);
-                your_ranks.clear();
-                delete your_graph;
+                delete graph->splitGraph(my_ranks, your_ranks);
             }
             else {
-                Comms::recv(MPI_ANY_SOURCE, 0, my_ranks);
-                Comms::recv(MPI_ANY_SOURCE, 0, *graph);
-            }
-
-            while ( my_ranks.size() != 1 ) {
-                // This means I have more data to pass on to other ranks
-                std::set<uint32_t>::iterator mid = my_ranks.begin();
-                for ( unsigned int i = 0; i < my_ranks.size() / 2; i++ ) {
-                    ++mid;
+                uint64_t num_chunks = 0;
+                Comms::recv(0, 0, num_chunks);
+                std::vector<ConfigGraph*> chunks;
+                for ( uint64_t i = 0; i < num_chunks; i++ ) {
+                    ConfigGraph* chunk = new ConfigGraph();
+                    Comms::recv(0, 0, *chunk);
+                    chunks.push_back(chunk);
                 }
-
-                your_ranks.insert(mid, my_ranks.end());
-                my_ranks.erase(mid, my_ranks.end());
-
-                // // ConfigGraph* your_graph = graph->getSubGraph(your_ranks);
-                ConfigGraph* your_graph = graph->splitGraph(my_ranks, your_ranks);
-
-                uint32_t dest = *your_ranks.begin();
-
-                Comms::send(dest, 0, your_ranks);
-                Comms::send(dest, 0, *your_graph);
-                your_ranks.clear();
-                delete your_graph;
+                graph->addChunks(chunks);
             }
         }
         catch ( std::exception& e ) {
@@ -922,11 +1250,15 @@ main(int argc, char* argv[])
     }
 #endif
 
+    double         graph_dist_time = sst_get_cpu_time() - start_graph_dist;
+    const uint64_t graph_dist_rss  = localMemSize();
+
     ////// End Broadcast Graph //////
     if ( cfg.parallel_output() ) { doParallelCapableGraphOutput(&cfg, graph, myRank, world_size); }
 
 
     ////// Create Simulation //////
+    setBarrierDefaults(cfg);
     Core::ThreadSafe::Barrier mainBarrier(world_size.thread);
 
     Simulation_impl::factory    = factory;
@@ -969,6 +1301,8 @@ main(int argc, char* argv[])
 
     double total_end_time = sst_get_cpu_time();
 
+    write_component_weights(cfg, threadInfo, myRank, world_size);
+
     for ( uint32_t i = 1; i < world_size.thread; i++ ) {
         threadInfo[0].simulated_time = std::max(threadInfo[0].simulated_time, threadInfo[i].simulated_time);
         threadInfo[0].run_time       = std::max(threadInfo[0].run_time, threadInfo[i].run_time);
@@ -983,7 +1317,11 @@ main(int argc, char* argv[])
     double run_time   = threadInfo[0].run_time;
     double total_time = total_end_time - start;
 
-    double max_run_time = 0, max_build_time = 0, max_total_time = 0;
+    double max_run_time = 0, max_build_time = 0, max_total_time = 0, max_graph_dist_time = 0;
+
+    // Rank 0 starts with the whole graph, so report it separately
+    uint64_t other_graph_dist_rss     = myRank.rank == 0 ? 0 : graph_dist_rss;
+    uint64_t max_other_graph_dist_rss = 0;
 
     uint64_t local_max_tv_depth      = threadInfo[0].max_tv_depth;
     uint64_t global_max_tv_depth     = 0;
@@ -996,12 +1334,18 @@ main(int argc, char* argv[])
     int64_t active_activities = 0, global_active_activities = 0;
     Core::MemPoolAccessor::getMemPoolUsage(mempool_size, active_activities);
 
+    uint64_t mempool_direct_lookups = 0, global_mempool_direct_lookups = 0;
+    uint64_t mempool_search_lookups = 0, global_mempool_search_lookups = 0;
+    Core::MemPoolAccessor::getMemPoolLookupCounts(mempool_direct_lookups, mempool_search_lookups);
+
 #ifdef SST_CONFIG_HAVE_MPI
     uint64_t local_sync_data_size = threadInfo[0].sync_data_size;
 
     MPI_Allreduce(&run_time, &max_run_time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
     MPI_Allreduce(&build_time, &max_build_time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
     MPI_Allreduce(&total_time, &max_total_time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    MPI_Allreduce(&graph_dist_time, &max_graph_dist_time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    MPI_Allreduce(&other_graph_dist_rss, &max_other_graph_dist_rss, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
     MPI_Allreduce(&local_max_tv_depth, &global_max_tv_depth, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
     MPI_Allreduce(&local_current_tv_depth, &global_current_tv_depth, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
     MPI_Allreduce(&local_sync_data_size, &global_max_sync_data_size, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
@@ -1009,17 +1353,25 @@ main(int argc, char* argv[])
     MPI_Allreduce(&mempool_size, &max_mempool_size, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
     MPI_Allreduce(&mempool_size, &global_mempool_size, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
     MPI_Allreduce(&active_activities, &global_active_activities, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(
+        &mempool_direct_lookups, &global_mempool_direct_lookups, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(
+        &mempool_search_lookups, &global_mempool_search_lookups, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
 #else
-    max_build_time            = build_time;
-    max_run_time              = run_time;
-    max_total_time            = total_time;
-    global_max_tv_depth       = local_max_tv_depth;
-    global_current_tv_depth   = local_current_tv_depth;
-    global_max_sync_data_size = 0;
-    global_max_sync_data_size = 0;
-    max_mempool_size          = mempool_size;
-    global_mempool_size       = mempool_size;
-    global_active_activities  = active_activities;
+    max_build_time                = build_time;
+    max_run_time                  = run_time;
+    max_total_time                = total_time;
+    max_graph_dist_time           = graph_dist_time;
+    max_other_graph_dist_rss      = other_graph_dist_rss;
+    global_max_tv_depth           = local_max_tv_depth;
+    global_current_tv_depth       = local_current_tv_depth;
+    global_max_sync_data_size     = 0;
+    global_max_sync_data_size     = 0;
+    max_mempool_size              = mempool_size;
+    global_mempool_size           = mempool_size;
+    global_active_activities      = active_activities;
+    global_mempool_direct_lookups = mempool_direct_lookups;
+    global_mempool_search_lookups = mempool_search_lookups;
 #endif
 
     const uint64_t local_max_rss     = maxLocalMemSize();
@@ -1037,6 +1389,12 @@ main(int argc, char* argv[])
         ua_buffer = format_string("%" PRIu64 "KB", global_max_rss);
         UnitAlgebra global_rss_ua(ua_buffer);
 
+        ua_buffer = format_string("%" PRIu64 "KB", graph_dist_rss);
+        UnitAlgebra graph_dist_rss_ua(ua_buffer);
+
+        ua_buffer = format_string("%" PRIu64 "KB", max_other_graph_dist_rss);
+        UnitAlgebra other_graph_dist_rss_ua(ua_buffer);
+
         ua_buffer = format_string("%" PRIu64 "B", global_max_sync_data_size);
         UnitAlgebra global_max_sync_data_size_ua(ua_buffer);
 
@@ -1056,6 +1414,9 @@ main(int argc, char* argv[])
         g_output.output("  Build time:                      %f seconds\n", max_build_time);
         g_output.output("  Run loop time:                   %f seconds\n", max_run_time);
         g_output.output("  Total time:                      %f seconds\n", max_total_time);
+        if ( world_size.rank > 1 && !cfg.parallel_load() ) {
+            g_output.output("  Graph distribution time:         %f seconds\n", max_graph_dist_time);
+        }
         g_output.output("\n");
         g_output.output(
             "Simulated time:                    %s\n", threadInfo[0].simulated_time.toStringBestSI().c_str());
@@ -1063,6 +1424,11 @@ main(int argc, char* argv[])
         g_output.output("Simulation Resource Information:\n");
         g_output.output("  Max Resident Set Size:           %s\n", max_rss_ua.toStringBestSI().c_str());
         g_output.output("  Approx. Global Max RSS Size:     %s\n", global_rss_ua.toStringBestSI().c_str());
+        if ( world_size.rank > 1 && !cfg.parallel_load() ) {
+            g_output.output(
+                "  Graph distribution max RSS:      %s (rank 0), %s (other ranks)\n",
+                graph_dist_rss_ua.toStringBestSI().c_str(), other_graph_dist_rss_ua.toStringBestSI().c_str());
+        }
         g_output.output("  Max Local Page Faults:           %" PRIu64 " faults\n", local_max_pf);
         g_output.output("  Global Page Faults:              %" PRIu64 " faults\n", global_pf);
         g_output.output("  Max Output Blocks:               %" PRIu64 " blocks\n", global_max_io_out);
@@ -1070,6 +1436,9 @@ main(int argc, char* argv[])
         g_output.output("  Max mempool usage:               %s\n", max_mempool_size_ua.toStringBestSI().c_str());
         g_output.output("  Global mempool usage:            %s\n", global_mempool_size_ua.toStringBestSI().c_str());
         g_output.output("  Global active activities:        %" PRIu64 " activities\n", global_active_activities);
+        g_output.output(
+            "  Global mempool lookups:          %" PRIu64 " direct, %" PRIu64 " searched\n",
+            global_mempool_direct_lookups, global_mempool_search_lookups);
         g_output.output("  Current global TimeVortex depth: %" PRIu64 " entries\n", global_current_tv_depth);
         g_output.output("  Max TimeVortex depth:            %" PRIu64 " entries\n", global_max_tv_depth);
         g_output.output(
@@ -15,6 +15,7 @@
 
 #include "sst/core/mempoolAccessor.h"
 #include "sst/core/output.h"
+#include "sst/core/sst_types.h"
 #include "sst/core/threadsafe.h"
 
 #include <list>
@@ -269,34 +270,63 @@ struct PoolInfo_t
 };
 
 
+// Pools are created for size classes that are multiples of 8 bytes.
+// Classes up to mempool_max_direct_size bytes are found by directly
+// indexing a per thread table, larger ones are found by searching
+// the list of pools.
+static constexpr size_t mempool_class_shift        = 3;
+static constexpr size_t mempool_max_direct_size    = 4096;
+static constexpr size_t mempool_num_direct_classes = (mempool_max_direct_size >> mempool_class_shift) + 1;
+
+struct ThreadPools_t
+{
+    // All the pools for the thread
+    std::vector<PoolInfo_t> pools;
+
+    // Direct lookup table, indexed by size class
+    MemPoolNoMutex* direct[mempool_num_direct_classes] = {};
+
+    // Lookup counters
+    uint64_t direct_lookups = 0;
+    uint64_t search_lookups = 0;
+};
+
+
 // This is a vector where each thread has one entry.  Using a vector
 // so that the memory will be cleaned up.  There won't be a chance to
 // call delete[] if we use an array with new.
-static std::vector<std::vector<PoolInfo_t>> memPoolThreadVector;
+static std::vector<ThreadPools_t> memPoolThreadVector;
 
 // My local thread number
-thread_local int                      thread_num = -1;
-thread_local std::vector<PoolInfo_t>* myPools;
+thread_local int            thread_num = -1;
+thread_local ThreadPools_t* myPools;
 
 
 inline MemPoolNoMutex*
 getMemPool(std::size_t size) noexcept
 {
-    MemPoolNoMutex* pool = nullptr;
-
-    for ( auto& x : *myPools ) {
-        if ( x.size == size ) {
-            pool = x.pool;
-            break;
-        }
+    size_t size_class = (size + ((1 << mempool_class_shift) - 1)) >> mempool_class_shift;
+    size_t class_size = size_class << mempool_class_shift;
+
+    if ( LIKELY(size_class < mempool_num_direct_classes) ) {
+        myPools->direct_lookups++;
+        MemPoolNoMutex* pool = myPools->direct[size_class];
+        if ( LIKELY(nullptr != pool) ) return pool;
+
+        pool = new Core::MemPoolNoMutex(class_size + sizeof(uint64_t*));
+        myPools->direct[size_class] = pool;
+        myPools->pools.emplace_back(class_size, pool);
+        return pool;
     }
 
-    if ( nullptr == pool ) {
-        /* Still can't find it, alloc a new one */
-        // pool = new Core::MemPoolNoMutex(size + sizeof(PoolData_t));
-        pool = new Core::MemPoolNoMutex(size + sizeof(uint64_t*));
-        myPools->emplace_back(size, pool);
+    myPools->search_lookups++;
+    for ( auto& x : myPools->pools ) {
+        if ( x.size == class_size ) return x.pool;
     }
+
+    /* Still can't find it, alloc a new one */
+    MemPoolNoMutex* pool = new Core::MemPoolNoMutex(class_size + sizeof(uint64_t*));
+    myPools->pools.emplace_back(class_size, pool);
     return pool;
 }
 
@@ -350,7 +380,7 @@ MemPoolAccessor::getMemPoolUsage(int64_t& bytes, int64_t& active_entries)
     int64_t alloced = 0;
     int64_t freed   = 0;
     for ( auto&& pool_group : memPoolThreadVector ) {
-        for ( auto&& entry : pool_group ) {
+        for ( auto&& entry : pool_group.pools ) {
             bytes += entry.pool->getBytesMemUsed();
             alloced += entry.pool->getNumAllocatedEntries();
             freed += entry.pool->getNumFreedEntries();
@@ -359,11 +389,20 @@ MemPoolAccessor::getMemPoolUsage(int64_t& bytes, int64_t& active_entries)
     active_entries = alloced - freed;
 }
 
+void
+MemPoolAccessor::getMemPoolLookupCounts(uint64_t& direct_lookups, uint64_t& search_lookups)
+{
+    for ( auto&& pool_group : memPoolThreadVector ) {
+        direct_lookups += pool_group.direct_lookups;
+        search_lookups += pool_group.search_lookups;
+    }
+}
+
 void
 MemPoolAccessor::printUndeletedMemPoolItems(const std::string& header, Output& out)
 {
     for ( auto&& pool_group : memPoolThreadVector ) {
-        for ( auto&& entry : pool_group ) {
+        for ( auto&& entry : pool_group.pools ) {
             const std::list<uint8_t*>& arenas    = entry.pool->getArenas();
             size_t                     arenaSize = entry.pool->getArenaSize();
             size_t                     allocSize = entry.pool->getAllocSize();
@@ -465,6 +504,10 @@ MemPoolAccessor::getMemPoolUsage(int64_t& bytes, int64_t& active_entries)
     active_entries = 0;
 }
 
+void
+MemPoolAccessor::getMemPoolLookupCounts(uint64_t& UNUSED(direct_lookups), uint64_t& UNUSED(search_lookups))
+{}
+
 void
 MemPoolAccessor::printUndeletedMemPoolItems(const std::string& UNUSED(header), Output& UNUSED(out))
 {
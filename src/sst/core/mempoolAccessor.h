@@ -42,6 +42,14 @@ public:
     // aren't enabled, then nothing will be counted.
     static void getMemPoolUsage(int64_t& bytes, int64_t& active_entries);
 
+    // Gets the number of mempool lookups (one per allocation and one
+    // per free) for the rank.  Lookups for sizes with an entry in the
+    // direct lookup table are counted in direct_lookups, lookups that
+    // had to search the list of pools are counted in search_lookups.
+    // Counts are added to the values passed into the function.  If
+    // mempools aren't enabled, then nothing will be counted.
+    static void getMemPoolLookupCounts(uint64_t& direct_lookups, uint64_t& search_lookups);
+
     // Initialize the global mempool data structures
     static void initializeGlobalData(int num_threads, bool cache_align = false);
 
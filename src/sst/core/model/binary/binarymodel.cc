@@ -0,0 +1,151 @@
+// -*- c++ -*-
+
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/model/binary/binarymodel.h"
+
+#include "sst/core/cfgoutput/binaryConfigOutput.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/warnmacros.h"
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+#include <cinttypes>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+using namespace SST;
+using namespace SST::Core;
+
+SSTBinaryModelDefinition::SSTBinaryModelDefinition(
+    const std::string& script_file, int verbosity, Config* configObj, double UNUSED(start_time)) :
+    SSTModelDescription(configObj),
+    scriptName(script_file),
+    output(nullptr),
+    config(configObj)
+{
+    output = new Output("SSTBinaryModel: ", verbosity, 0, SST::Output::STDOUT);
+
+    output->verbose(CALL_INFO, 2, 0, "SST loading a binary model from file: %s\n", script_file.c_str());
+}
+
+SSTBinaryModelDefinition::~SSTBinaryModelDefinition()
+{
+    delete output;
+}
+
+ConfigGraph*
+SSTBinaryModelDefinition::createConfigGraph()
+{
+    int fd = open(scriptName.c_str(), O_RDONLY);
+    if ( fd < 0 ) { output->fatal(CALL_INFO, 1, "Error opening binary model: %s\n", scriptName.c_str()); }
+
+    struct stat st;
+    if ( fstat(fd, &st) != 0 ) { output->fatal(CALL_INFO, 1, "Error reading binary model: %s\n", scriptName.c_str()); }
+    const size_t file_size = st.st_size;
+    if ( file_size < sizeof(BinaryGraphHeader) ) {
+        output->fatal(CALL_INFO, 1, "Binary model is too short to be a graph: %s\n", scriptName.c_str());
+    }
+
+    // Only the pages of the sections that are read get loaded
+    void* map = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if ( map == MAP_FAILED ) { output->fatal(CALL_INFO, 1, "Error mapping binary model: %s\n", scriptName.c_str()); }
+    char* base = static_cast<char*>(map);
+
+    BinaryGraphHeader header;
+    memcpy(&header, base, sizeof(header));
+    if ( memcmp(header.magic, "SSTGRAPH", sizeof(header.magic)) != 0 ) {
+        output->fatal(CALL_INFO, 1, "File is not a binary SST graph: %s\n", scriptName.c_str());
+    }
+    if ( header.version != BinaryGraphHeader::current_version ) {
+        output->fatal(
+            CALL_INFO, 1, "Binary model %s has format version %" PRIu32 ", but only version %" PRIu32 " is supported\n",
+            scriptName.c_str(), header.version, BinaryGraphHeader::current_version);
+    }
+    if ( header.globals_offset + header.globals_size > file_size ||
+         header.sections_offset + header.num_sections * sizeof(BinaryGraphSection) > file_size ) {
+        output->fatal(CALL_INFO, 1, "Binary model is truncated: %s\n", scriptName.c_str());
+    }
+
+    // The serializer only reads from the buffer, so the mapping can
+    // be read only
+    SST::Core::Serialization::serializer             ser;
+    std::vector<std::pair<std::string, std::string>> options;
+    ser.start_unpacking(base + header.globals_offset, header.globals_size);
+    ser& options;
+    serializeParamKeyMaps(ser);
+
+    for ( auto& option : options ) {
+        setOptionFromModel(option.first, option.second);
+    }
+
+    uint32_t num_ranks = 1;
+    uint32_t my_rank   = 0;
+#ifdef SST_CONFIG_HAVE_MPI
+    int mpi_size = 1, mpi_rank = 0;
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    num_ranks = mpi_size;
+    my_rank   = mpi_rank;
+#endif
+    const bool parallel = config->parallel_load() && num_ranks > 1;
+    if ( parallel && header.num_ranks != num_ranks ) {
+        output->fatal(
+            CALL_INFO, 1,
+            "Binary model %s was partitioned for %" PRIu32 " ranks and can only be loaded in parallel on that many "
+            "ranks, not %" PRIu32 "\n",
+            scriptName.c_str(), header.num_ranks, num_ranks);
+    }
+
+    std::vector<BinaryGraphSection> sections(header.num_sections);
+    memcpy(sections.data(), base + header.sections_offset, header.num_sections * sizeof(BinaryGraphSection));
+
+    // With parallel load, the ghosts in the sections stand in for the
+    // components on the other ranks, as they do when rank 0 sends each
+    // rank its part of the graph.  Otherwise every component is in the
+    // section of its own rank and the ghosts are not needed.
+    std::vector<ConfigGraph*> chunks;
+    for ( const BinaryGraphSection& section : sections ) {
+        if ( parallel && section.rank != my_rank ) continue;
+        if ( section.offset + section.size > file_size ) {
+            output->fatal(CALL_INFO, 1, "Binary model is truncated: %s\n", scriptName.c_str());
+        }
+
+        ConfigGraph* chunk = new ConfigGraph();
+        ser.start_unpacking(base + section.offset, section.size);
+        ser& *chunk;
+        if ( !parallel ) chunk->deleteGhosts(section.rank);
+        chunks.push_back(chunk);
+
+        output->verbose(
+            CALL_INFO, 4, 0, "Read %" PRIu32 " components for rank %" PRIu32 "\n", section.num_components,
+            section.rank);
+    }
+
+    munmap(map, file_size);
+
+    ConfigGraph* graph = new ConfigGraph();
+    graph->addChunks(chunks);
+    return graph;
+}
@@ -0,0 +1,63 @@
+// -*- c++ -*-
+
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_MODEL_BINARY_BINARYMODEL_H
+#define SST_CORE_MODEL_BINARY_BINARYMODEL_H
+
+#include "sst/core/config.h"
+#include "sst/core/configGraph.h"
+#include "sst/core/model/sstmodel.h"
+#include "sst/core/output.h"
+#include "sst/core/sst_types.h"
+
+#include <string>
+
+namespace SST {
+namespace Core {
+
+/**
+ * Loads a graph written by --output-binary.  The file is mapped into
+ * memory and the chunks of the graph in it are unpacked directly, so
+ * there is no parsing.  With parallel load, each rank only reads the
+ * sections holding its own components, which requires the graph to
+ * have been partitioned for the same number of ranks.  Otherwise all
+ * the sections are read and the graph is partitioned again.
+ */
+class SSTBinaryModelDefinition : public SSTModelDescription
+{
+public:
+    SST_ELI_REGISTER_MODEL_DESCRIPTION(
+          SST::Core::SSTBinaryModelDefinition,
+          "sst",
+          "model.binary",
+          SST_ELI_ELEMENT_VERSION(1,0,0),
+          "Binary model for loading SST simulation graphs written by --output-binary",
+          true)
+
+    SST_ELI_DOCUMENT_MODEL_SUPPORTED_EXTENSIONS(".sstb")
+
+    SSTBinaryModelDefinition(const std::string& script_file, int verbosity, Config* config, double start_time);
+    virtual ~SSTBinaryModelDefinition();
+
+    ConfigGraph* createConfigGraph() override;
+
+protected:
+    std::string scriptName;
+    Output*     output;
+    Config*     config;
+};
+
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_MODEL_BINARY_BINARYMODEL_H
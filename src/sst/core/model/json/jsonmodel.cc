@@ -15,6 +15,12 @@
 
 #include "sst/core/model/json/jsonmodel.h"
 
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
 #include <string>
 
 DISABLE_WARN_STRICT_ALIASING
@@ -30,10 +36,20 @@ SSTJSONModelDefinition::SSTJSONModelDefinition(
     config(configObj),
     graph(nullptr),
     nextComponentId(0),
-    start_time(start_time)
+    start_time(start_time),
+    myRank(0),
+    parallel(false)
 {
     output = new Output("SSTJSONModel: ", verbosity, 0, SST::Output::STDOUT);
 
+#ifdef SST_CONFIG_HAVE_MPI
+    int mpi_size = 1, mpi_rank = 0;
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    myRank   = mpi_rank;
+    parallel = config->parallel_load() && mpi_size > 1;
+#endif
+
     graph = new ConfigGraph();
     if ( !graph ) { output->fatal(CALL_INFO, 1, "Could not create graph object in JSON loader.\n"); }
 
@@ -45,29 +61,28 @@ SSTJSONModelDefinition::~SSTJSONModelDefinition()
     delete output;
 }
 
-ComponentId_t
-SSTJSONModelDefinition::findComponentIdByName(const std::string& Name)
+ConfigComponent*
+SSTJSONModelDefinition::findComponentByName(const std::string& Name)
 {
-    ComponentId_t    Id   = -1;
     ConfigComponent* Comp = nullptr;
 
     if ( Name.length() == 0 ) {
-        output->fatal(CALL_INFO, 1, "Error: Name given to findComponentIdByName is null\n");
-        return Id;
+        output->fatal(CALL_INFO, 1, "Error: Name given to findComponentByName is null\n");
+        return Comp;
     }
 
-    // first, find the component pointer from the name
+    // find the component pointer from the name
     Comp = graph->findComponentByName(Name);
     if ( Comp == nullptr ) {
-        output->fatal(CALL_INFO, 1, "Error finding component ID by name: %s\n", Name.c_str());
-        return Id;
+        output->fatal(CALL_INFO, 1, "Error finding component by name: %s\n", Name.c_str());
+        return Comp;
     }
 
-    return Comp->id;
+    return Comp;
 }
 
 void
-SSTJSONModelDefinition::recursiveSubcomponent(ConfigComponent* Parent, const nlohmann::basic_json<>& compArray)
+SSTJSONModelDefinition::recursiveSubcomponent(ConfigComponent* Parent, const json& compArray, bool ghost)
 {
     std::string      Name;
     std::string      Type;
@@ -106,14 +121,14 @@ SSTJSONModelDefinition::recursiveSubcomponent(ConfigComponent* Parent, const nlo
         Comp = Parent->addSubComponent(Name, Type, Slot);
 
         // read all the parameters
-        if ( subArray.contains("params") ) {
+        if ( !ghost && subArray.contains("params") ) {
             for ( auto& paramArray : subArray["params"].items() ) {
                 Comp->addParameter(paramArray.key(), paramArray.value(), false);
             }
         }
 
         // read all the global parameters
-        if ( subArray.contains("params_global_sets") ) {
+        if ( !ghost && subArray.contains("params_global_sets") ) {
             for ( auto& globalArray : subArray["params_global_sets"].items() ) {
                 Comp->addGlobalParamSet(globalArray.value().get<std::string>());
             }
@@ -122,13 +137,13 @@ SSTJSONModelDefinition::recursiveSubcomponent(ConfigComponent* Parent, const nlo
         // recursively build up the subcomponents
         if ( subArray.contains("subcomponents") ) {
             auto& subsubArray = subArray["subcomponents"];
-            if ( subsubArray.size() > 0 ) { recursiveSubcomponent(Comp, subArray); }
+            if ( subsubArray.size() > 0 ) { recursiveSubcomponent(Comp, subArray, ghost); }
         }
     }
 }
 
 void
-SSTJSONModelDefinition::discoverComponents(const json& jFile)
+SSTJSONModelDefinition::discoverComponent(const json& compArray)
 {
     std::string      Name;
     std::string      Type;
@@ -137,159 +152,152 @@ SSTJSONModelDefinition::discoverComponents(const json& jFile)
     uint32_t         rank   = 0;
     uint32_t         thread = 0;
 
-    if ( !jFile.contains("components") ) {
-        output->fatal(CALL_INFO, 1, "Error, no \"components\" section in json file: %s\n", scriptName.c_str());
+    // -- Name
+    auto x = compArray.find("name");
+    if ( x != compArray.end() ) { Name = x.value(); }
+    else {
+        output->fatal(CALL_INFO, 1, "Error discovering component name from script: %s\n", scriptName.c_str());
     }
 
-    for ( auto& compArray : jFile["components"] ) {
-        // -- Name
-        auto x = compArray.find("name");
-        if ( x != compArray.end() ) { Name = x.value(); }
-        else {
-            output->fatal(CALL_INFO, 1, "Error discovering component name from script: %s\n", scriptName.c_str());
-        }
+    // -- Type
+    x = compArray.find("type");
+    if ( x != compArray.end() ) { Type = x.value(); }
+    else {
+        output->fatal(CALL_INFO, 1, "Error discovering component type from script: %s\n", scriptName.c_str());
+    }
 
-        // -- Type
-        x = compArray.find("type");
-        if ( x != compArray.end() ) { Type = x.value(); }
-        else {
-            output->fatal(CALL_INFO, 1, "Error discovering component type from script: %s\n", scriptName.c_str());
+    // read the partition info
+    x = compArray.find("partition");
+    if ( x != compArray.end() ) {
+        for ( auto& partArray : x->items() ) {
+            if ( partArray.key() == "rank" ) { rank = partArray.value(); }
+            else if ( partArray.key() == "thread" ) {
+                thread = partArray.value();
+            }
         }
+    }
 
-        // Add the component so we have the ComponentID
-        Id = graph->addComponent(Name, Type);
+    // With parallel load, components on other ranks are only needed
+    // as ghosts for the links into this rank, so skip their
+    // parameters.  The ones no such link touches are deleted once the
+    // links have been read.
+    bool ghost = parallel && rank != myRank;
 
-        Comp = graph->findComponent(Id);
+    // Add the component so we have the ComponentID
+    Id = graph->addComponent(Name, Type);
 
-        // read all the parameters
-        if ( compArray.contains("params") ) {
-            for ( auto& paramArray : compArray["params"].items() ) {
-                Comp->addParameter(paramArray.key(), paramArray.value(), false);
-            }
-        }
+    Comp = graph->findComponent(Id);
 
-        // read all the global parameters
-        if ( compArray.contains("params_global_sets") ) {
-            for ( auto& globalArray : compArray["params_global_sets"].items() ) {
-                Comp->addGlobalParamSet(globalArray.value().get<std::string>());
-            }
+    // read all the parameters
+    if ( !ghost && compArray.contains("params") ) {
+        for ( auto& paramArray : compArray["params"].items() ) {
+            Comp->addParameter(paramArray.key(), paramArray.value(), false);
         }
+    }
 
-        // read the partition info
-        if ( compArray.contains("partition") ) {
-            for ( auto& partArray : compArray["partition"].items() ) {
-                if ( partArray.key() == "rank" ) { rank = partArray.value(); }
-                else if ( partArray.key() == "thread" ) {
-                    thread = partArray.value();
-                }
-            }
+    // read all the global parameters
+    if ( !ghost && compArray.contains("params_global_sets") ) {
+        for ( auto& globalArray : compArray["params_global_sets"].items() ) {
+            Comp->addGlobalParamSet(globalArray.value().get<std::string>());
         }
+    }
 
-        // set the rank information
-        RankInfo Rank(rank, thread);
-        Comp->setRank(Rank);
-
-        // recursively read the subcomponents
-        recursiveSubcomponent(Comp, compArray);
+    // set the rank information
+    RankInfo Rank(rank, thread);
+    Comp->setRank(Rank);
 
-        // reset the variables
-        Id   = -1;
-        Comp = nullptr;
-    }
+    // recursively read the subcomponents
+    recursiveSubcomponent(Comp, compArray, ghost);
 }
 
 void
-SSTJSONModelDefinition::discoverLinks(const json& jFile)
+SSTJSONModelDefinition::discoverLink(const json& linkArray)
 {
-    std::string   Name;
-    std::string   Comp[2];
-    std::string   Port[2];
-    std::string   Latency[2];
-    bool          NoCut = false;
-    ComponentId_t LinkID;
-
-    if ( !jFile.contains("links") ) {
-        output->fatal(CALL_INFO, 1, "Error, no \"links\" section in json file: %s\n", scriptName.c_str());
+    std::string      Name;
+    std::string      Comp[2];
+    std::string      Port[2];
+    std::string      Latency[2];
+    bool             NoCut = false;
+    ConfigComponent* Ends[2];
+
+    // -- Name
+    auto x = linkArray.find("name");
+    if ( x != linkArray.end() ) { Name = x.value(); }
+    else {
+        output->fatal(CALL_INFO, 1, "Error discovering link name from script: %s\n", scriptName.c_str());
     }
 
-    for ( auto& linkArray : jFile["links"] ) {
-        // -- Name
-        auto x = linkArray.find("name");
-        if ( x != linkArray.end() ) { Name = x.value(); }
-        else {
-            output->fatal(CALL_INFO, 1, "Error discovering link name from script: %s\n", scriptName.c_str());
+    // -- NoCut
+    x = linkArray.find("noCut");
+    if ( x != linkArray.end() ) { NoCut = x.value(); }
+    else {
+        NoCut = false;
+    }
+
+    // -- Components
+    std::string sides[2] = { "left", "right" };
+    for ( int i = 0; i < 2; ++i ) {
+        auto side = linkArray.find(sides[i]);
+        if ( side == linkArray.end() ) {
+            output->fatal(
+                CALL_INFO, 1, "Error discovering %s link component for Link=%s from script: %s\n", sides[i].c_str(),
+                Name.c_str(), scriptName.c_str());
         }
 
-        // -- NoCut
-        x = linkArray.find("noCut");
-        if ( x != linkArray.end() ) { NoCut = x.value(); }
+        auto item = side->find("component");
+        if ( item != side->end() ) { Comp[i] = item.value(); }
         else {
-            NoCut = false;
+            output->fatal(
+                CALL_INFO, 1, "Error finding component field of %s link component for Link=%s from script: %s\n",
+                sides[i].c_str(), Name.c_str(), scriptName.c_str());
         }
 
-        // -- Components
-        std::string sides[2] = { "left", "right" };
-        for ( int i = 0; i < 2; ++i ) {
-            auto side = linkArray.find(sides[i]);
-            if ( side == linkArray.end() ) {
-                output->fatal(
-                    CALL_INFO, 1, "Error discovering %s link component for Link=%s from script: %s\n", sides[i].c_str(),
-                    Name.c_str(), scriptName.c_str());
-            }
+        // -- Port
+        item = side->find("port");
+        if ( item != side->end() ) { Port[i] = item.value(); }
+        else {
+            output->fatal(
+                CALL_INFO, 1, "Error finding port field of %s link component for Link=%s from script: %s\n",
+                sides[i].c_str(), Name.c_str(), scriptName.c_str());
+        }
 
-            auto item = side->find("component");
-            if ( item != side->end() ) { Comp[i] = item.value(); }
-            else {
-                output->fatal(
-                    CALL_INFO, 1, "Error finding component field of %s link component for Link=%s from script: %s\n",
-                    sides[i].c_str(), Name.c_str(), scriptName.c_str());
-            }
+        // -- Latency
+        item = side->find("latency");
+        if ( item != side->end() ) { Latency[i] = item.value(); }
+        else {
+            output->fatal(
+                CALL_INFO, 1, "Error finding latency field of %s link component for Link=%s from script: %s\n",
+                sides[i].c_str(), Name.c_str(), scriptName.c_str());
+        }
 
-            // -- Port
-            item = side->find("port");
-            if ( item != side->end() ) { Port[i] = item.value(); }
-            else {
-                output->fatal(
-                    CALL_INFO, 1, "Error finding port field of %s link component for Link=%s from script: %s\n",
-                    sides[i].c_str(), Name.c_str(), scriptName.c_str());
-            }
+        Ends[i] = findComponentByName(Comp[i]);
+    }
 
-            // -- Latency
-            item = side->find("latency");
-            if ( item != side->end() ) { Latency[i] = item.value(); }
-            else {
-                output->fatal(
-                    CALL_INFO, 1, "Error finding latency field of %s link component for Link=%s from script: %s\n",
-                    sides[i].c_str(), Name.c_str(), scriptName.c_str());
-            }
+    // Links between two other ranks are not needed with parallel load
+    if ( parallel && Ends[0]->rank.rank != myRank && Ends[1]->rank.rank != myRank ) return;
 
-            LinkID = findComponentIdByName(Comp[i]);
-            graph->addLink(LinkID, Name, Port[i], Latency[i], NoCut);
-        }
+    for ( int i = 0; i < 2; ++i ) {
+        graph->addLink(Ends[i]->id, Name, Port[i], Latency[i], NoCut);
     }
 }
 
 void
-SSTJSONModelDefinition::discoverProgramOptions(const json& jFile)
+SSTJSONModelDefinition::discoverProgramOptions(const json& options)
 {
-    if ( jFile.contains("program_options") ) {
-        for ( auto& option : jFile["program_options"].items() ) {
-            setOptionFromModel(option.key(), option.value());
-        }
+    for ( auto& option : options.items() ) {
+        setOptionFromModel(option.key(), option.value());
     }
 }
 
 void
-SSTJSONModelDefinition::discoverGlobalParams(const json& jFile)
+SSTJSONModelDefinition::discoverGlobalParams(const json& globalParams)
 {
     std::string GlobalName;
 
-    if ( jFile.contains("global_params") ) {
-        for ( auto& gp : jFile["global_params"].items() ) {
-            GlobalName = gp.key();
-            for ( auto& param : jFile["global_params"].at(GlobalName).items() ) {
-                graph->addGlobalParam(GlobalName, param.key(), param.value().get<std::string>());
-            }
+    for ( auto& gp : globalParams.items() ) {
+        GlobalName = gp.key();
+        for ( auto& param : gp.value().items() ) {
+            graph->addGlobalParam(GlobalName, param.key(), param.value().get<std::string>());
         }
     }
 }
@@ -304,23 +312,92 @@ SSTJSONModelDefinition::createConfigGraph()
         return nullptr;
     }
 
-    // create parsed json object
-    json jFile = json::parse(ifs);
+    ifs.seekg(0, std::ios::end);
+    const double file_size = ifs.tellg();
+    ifs.seekg(0, std::ios::beg);
+
+    // The file is streamed through the parser and each top level
+    // section, component and link is handed off as soon as it is
+    // complete.  Returning false drops it from the document, so only
+    // one component has to be held in memory at a time.  Links can
+    // only be added once all the components exist, so any that come
+    // first are held until the end.
+    std::string       section;
+    bool              found_components = false;
+    bool              found_links      = false;
+    bool              components_done  = false;
+    std::vector<json> pending_links;
+
+    auto callback = [&](int depth, json::parse_event_t event, json& parsed) -> bool {
+        if ( depth == 1 && event == json::parse_event_t::key ) {
+            section = parsed.get<std::string>();
+            if ( section == "components" ) found_components = true;
+            if ( section == "links" ) found_links = true;
+            return true;
+        }
+
+        if ( depth == 1 && event == json::parse_event_t::object_end ) {
+            if ( section == "program_options" ) {
+                discoverProgramOptions(parsed);
+                return false;
+            }
+            if ( section == "global_params" ) {
+                discoverGlobalParams(parsed);
+                return false;
+            }
+        }
+
+        if ( depth == 1 && event == json::parse_event_t::array_end && section == "components" ) {
+            components_done = true;
+        }
+
+        if ( depth == 2 && event == json::parse_event_t::object_end ) {
+            if ( section == "components" ) {
+                discoverComponent(parsed);
+                return false;
+            }
+            if ( section == "links" ) {
+                if ( components_done ) { discoverLink(parsed); }
+                else {
+                    pending_links.push_back(std::move(parsed));
+                }
+                return false;
+            }
+        }
+        return true;
+    };
+
+    double start = sst_get_cpu_time();
+    try {
+        // Everything of interest is taken out by the callback, so what
+        // is left of the document is not needed
+        json remainder = json::parse(ifs, callback);
+    }
+    catch ( json::exception& e ) {
+        output->fatal(CALL_INFO, 1, "Error parsing JSON model from script %s: %s\n", scriptName.c_str(), e.what());
+    }
+    double elapsed = sst_get_cpu_time() - start;
 
     // close the file
     ifs.close();
 
-    // discover all the globals
-    discoverProgramOptions(jFile);
+    if ( !found_components ) {
+        output->fatal(CALL_INFO, 1, "Error, no \"components\" section in json file: %s\n", scriptName.c_str());
+    }
+    if ( !found_links ) {
+        output->fatal(CALL_INFO, 1, "Error, no \"links\" section in json file: %s\n", scriptName.c_str());
+    }
 
-    // discover the global parameters
-    discoverGlobalParams(jFile);
+    for ( auto& link : pending_links ) {
+        discoverLink(link);
+    }
 
-    // discover the components
-    discoverComponents(jFile);
+    // Ghosts that no link into this rank reached are not needed
+    if ( parallel ) graph->deleteUnlinkedGhosts(myRank);
 
-    // discover the links
-    discoverLinks(jFile);
+    output->verbose(
+        CALL_INFO, 1, 0, "Parsed %.1f MB of JSON in %.3f seconds (%.1f MB/s)\n", file_size / 1.0e6, elapsed,
+        elapsed > 0.0 ? file_size / 1.0e6 / elapsed : 0.0);
 
     // TODO: discover statistics
 
@@ -64,14 +64,16 @@ protected:
     ConfigGraph*  graph;
     ComponentId_t nextComponentId;
     double        start_time;
+    uint32_t      myRank;
+    bool          parallel; // Only build the components in myRank
 
 private:
-    void          recursiveSubcomponent(ConfigComponent* Parent, const nlohmann::basic_json<>& compArray);
-    void          discoverProgramOptions(const json& jFile);
-    void          discoverComponents(const json& jFile);
-    void          discoverLinks(const json& jFile);
-    void          discoverGlobalParams(const json& jFile);
-    ComponentId_t findComponentIdByName(const std::string& Name);
+    void             recursiveSubcomponent(ConfigComponent* Parent, const json& compArray, bool ghost);
+    void             discoverProgramOptions(const json& options);
+    void             discoverComponent(const json& compArray);
+    void             discoverLink(const json& linkArray);
+    void             discoverGlobalParams(const json& globalParams);
+    ConfigComponent* findComponentByName(const std::string& Name);
 };
 
 } // namespace Core
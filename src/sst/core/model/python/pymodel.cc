@@ -41,6 +41,7 @@ DISABLE_WARN_MISSING_OVERRIDE
 REENABLE_WARNING
 #endif
 
+#include <map>
 #include <string>
 
 DISABLE_WARN_STRICT_ALIASING
@@ -311,6 +312,8 @@ getProgramOptions(PyObject* UNUSED(self), PyObject* UNUSED(args))
     PyDict_SetItem(dict, SST_ConvertToPythonString("exit-after"), SST_ConvertToPythonLong(cfg->exit_after()));
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("partitioner"), SST_ConvertToPythonString(cfg->partitioner().c_str()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("imbalance-tolerance"), PyFloat_FromDouble(cfg->imbalance_tolerance()));
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("heartbeat-period"), SST_ConvertToPythonString(cfg->heartbeatPeriod().c_str()));
     PyDict_SetItem(
@@ -343,6 +346,18 @@ getProgramOptions(PyObject* UNUSED(self), PyObject* UNUSED(args))
         dict, SST_ConvertToPythonString("time-vortex"), SST_ConvertToPythonString(cfg->timeVortex().c_str()));
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("interthread-links"), SST_ConvertToPythonBool(cfg->interthread_links()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("shared-memory-ranks"), SST_ConvertToPythonBool(cfg->shared_memory_ranks()));
+    PyDict_SetItem(dict, SST_ConvertToPythonString("async-rank-sync"), SST_ConvertToPythonBool(cfg->async_rank_sync()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("per-peer-lookahead"), SST_ConvertToPythonBool(cfg->per_peer_lookahead()));
+    PyDict_SetItem(dict, SST_ConvertToPythonString("fifo-links"), SST_ConvertToPythonBool(cfg->fifo_links()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("untimed-quiescence"), SST_ConvertToPythonBool(cfg->untimed_quiescence()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("barrier-type"), SST_ConvertToPythonString(cfg->barrier_type().c_str()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("barrier-wait"), SST_ConvertToPythonString(cfg->barrier_wait().c_str()));
     PyDict_SetItem(dict, SST_ConvertToPythonString("debug-file"), SST_ConvertToPythonString(cfg->debugFile().c_str()));
     PyDict_SetItem(dict, SST_ConvertToPythonString("lib-path"), SST_ConvertToPythonString(cfg->libpath().c_str()));
     PyDict_SetItem(
@@ -354,6 +369,12 @@ getProgramOptions(PyObject* UNUSED(self), PyObject* UNUSED(args))
         SST_ConvertToPythonString(cfg->enabledProfiling().c_str()));
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("profiling-output"), SST_ConvertToPythonString(cfg->profilingOutput().c_str()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("output-component-weights"),
+        SST_ConvertToPythonString(cfg->outputComponentWeights().c_str()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("component-weights"),
+        SST_ConvertToPythonString(cfg->componentWeights().c_str()));
 
     // Advanced options - debug
     PyDict_SetItem(dict, SST_ConvertToPythonString("run-mode"), SST_ConvertToPythonString(cfg->runMode_str().c_str()));
@@ -899,6 +920,262 @@ getLocalMemoryUsage(PyObject* UNUSED(self), PyObject* UNUSED(args))
     return res;
 }
 
+// Link between components i and j of a generator, with the extra
+// items the neighbors function returned with j
+struct GeneratorEdge
+{
+    uint64_t  i;
+    uint64_t  j;
+    PyObject* extra;
+};
+
+// Call neighbors(i) and append the edges to components for which keep
+// returns true
+template <typename Keep>
+static bool
+getGeneratorEdges(PyObject* neighbors, uint64_t i, uint64_t count, std::vector<GeneratorEdge>& edges, Keep keep)
+{
+    PyObject* list = PyObject_CallFunction(neighbors, "K", (unsigned long long)i);
+    if ( nullptr == list ) return false;
+    PyObject* iter = PyObject_GetIter(list);
+    Py_DECREF(list);
+    if ( nullptr == iter ) return false;
+
+    bool      ok = true;
+    PyObject* item;
+    while ( ok && (item = PyIter_Next(iter)) != nullptr ) {
+        PyObject* first = PyTuple_Check(item) && PyTuple_Size(item) > 0 ? PyTuple_GetItem(item, 0) : item;
+        uint64_t  j     = PyLong_Check(first) ? PyLong_AsUnsignedLongLong(first) : count;
+        if ( PyErr_Occurred() || j >= count ) {
+            PyErr_Format(
+                PyExc_IndexError, "generate(): neighbor of component %llu is not a component index",
+                (unsigned long long)i);
+            ok = false;
+        }
+        else if ( keep(j) ) {
+            PyObject* extra = PyTuple_Check(item) ? PyTuple_GetSlice(item, 1, PyTuple_Size(item)) : PyTuple_New(0);
+            edges.push_back({ i, j, extra });
+        }
+        Py_DECREF(item);
+    }
+    Py_DECREF(iter);
+    return ok && !PyErr_Occurred();
+}
+
+// Get the rank of component i from the generator's rank function
+static bool
+getGeneratorRank(PyObject* rank_fn, uint64_t i, RankInfo& rank_info)
+{
+    PyObject* res = PyObject_CallFunction(rank_fn, "K", (unsigned long long)i);
+    if ( nullptr == res ) return false;
+    unsigned long rank = 0, thread = 0;
+    if ( PyLong_Check(res) ) { rank = PyLong_AsUnsignedLong(res); }
+    else if ( !PyTuple_Check(res) || !PyArg_ParseTuple(res, "k|k", &rank, &thread) ) {
+        PyErr_SetString(PyExc_TypeError, "generate(): rank must return a rank or a (rank, thread) tuple");
+    }
+    Py_DECREF(res);
+    if ( PyErr_Occurred() ) return false;
+    rank_info = RankInfo(rank, thread);
+    return true;
+}
+
+static PyObject*
+generate(PyObject* UNUSED(self), PyObject* args)
+{
+    unsigned long long count     = 0;
+    PyObject*          build     = nullptr;
+    PyObject*          neighbors = nullptr;
+    PyObject*          connect   = nullptr;
+    PyObject*          rank_fn   = nullptr;
+    PyObject*          local_fn  = nullptr;
+
+    if ( !PyArg_ParseTuple(args, "KOOO|OO", &count, &build, &neighbors, &connect, &rank_fn, &local_fn) )
+        return nullptr;
+    if ( rank_fn == Py_None ) rank_fn = nullptr;
+    if ( local_fn == Py_None ) local_fn = nullptr;
+    if ( !PyCallable_Check(build) || !PyCallable_Check(neighbors) || !PyCallable_Check(connect) ||
+         (rank_fn && !PyCallable_Check(rank_fn)) || (local_fn && !PyCallable_Check(local_fn)) ) {
+        PyErr_SetString(PyExc_TypeError, "generate(): build, neighbors, connect, rank and local must be callable");
+        return nullptr;
+    }
+    if ( local_fn && !rank_fn ) {
+        PyErr_SetString(PyExc_TypeError, "generate(): local can only be given with rank");
+        return nullptr;
+    }
+
+    Config*  cfg         = gModel->getConfig();
+    uint32_t num_ranks   = 1;
+    uint32_t my_rank     = 0;
+    uint32_t num_threads = cfg->num_threads();
+#ifdef SST_CONFIG_HAVE_MPI
+    int mpi_size = 1, mpi_rank = 0;
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    num_ranks = mpi_size;
+    my_rank   = mpi_rank;
+#endif
+    const bool parallel = cfg->parallel_load() && num_ranks > 1;
+
+    // Only the components this rank builds are tracked, so a rank's
+    // memory and calls into Python scale with its share of the model.
+    // Without a rank function, the components are split into
+    // contiguous blocks over all the threads.
+    struct Generated
+    {
+        RankInfo  rank;
+        bool      local;
+        PyObject* comp;
+    };
+    std::map<uint64_t, Generated> touched;
+
+    auto rankOf = [&](uint64_t i, RankInfo& rank_info) -> bool {
+        if ( rank_fn ) return getGeneratorRank(rank_fn, i, rank_info);
+        uint64_t slot = i * num_ranks * num_threads / count;
+        rank_info     = RankInfo(slot / num_threads, slot % num_threads);
+        return true;
+    };
+
+    bool                  ok = true;
+    std::vector<uint64_t> local;
+    if ( !parallel ) {
+        for ( uint64_t i = 0; i < count; i++ ) {
+            local.push_back(i);
+        }
+    }
+    else if ( !rank_fn ) {
+        // First index of each block, from i * num_ranks / count >= rank
+        const uint64_t lo = ((uint64_t)my_rank * count + num_ranks - 1) / num_ranks;
+        const uint64_t hi = ((uint64_t)(my_rank + 1) * count + num_ranks - 1) / num_ranks;
+        for ( uint64_t i = lo; i < hi; i++ ) {
+            local.push_back(i);
+        }
+    }
+    else if ( local_fn ) {
+        PyObject* list = PyObject_CallFunction(local_fn, "K", (unsigned long long)my_rank);
+        PyObject* iter = list ? PyObject_GetIter(list) : nullptr;
+        Py_XDECREF(list);
+        if ( nullptr == iter ) return nullptr;
+        PyObject* item;
+        while ( ok && (item = PyIter_Next(iter)) != nullptr ) {
+            uint64_t i = PyLong_Check(item) ? PyLong_AsUnsignedLongLong(item) : count;
+            Py_DECREF(item);
+            if ( PyErr_Occurred() || i >= count ) {
+                PyErr_SetString(PyExc_IndexError, "generate(): local returned something that is not a component index");
+                ok = false;
+            }
+            else {
+                local.push_back(i);
+            }
+        }
+        Py_DECREF(iter);
+        if ( !ok || PyErr_Occurred() ) return nullptr;
+    }
+    else {
+        // Nothing says which components are on this rank, so every
+        // rank has to ask about all of them
+        for ( uint64_t i = 0; i < count; i++ ) {
+            RankInfo rank_info;
+            if ( !getGeneratorRank(rank_fn, i, rank_info) ) return nullptr;
+            if ( rank_info.rank == my_rank ) touched[i] = { rank_info, true, nullptr };
+        }
+        for ( auto& kv : touched ) {
+            local.push_back(kv.first);
+        }
+    }
+
+    for ( uint64_t i : local ) {
+        if ( touched.count(i) ) {
+            if ( local_fn ) {
+                PyErr_Format(
+                    PyExc_ValueError, "generate(): local returned component %llu twice", (unsigned long long)i);
+                return nullptr;
+            }
+            continue;
+        }
+        RankInfo rank_info;
+        if ( !rankOf(i, rank_info) ) return nullptr;
+        if ( parallel && rank_info.rank != my_rank ) {
+            PyErr_Format(
+                PyExc_ValueError, "generate(): local returned component %llu, which rank puts on rank %lu",
+                (unsigned long long)i, (unsigned long)rank_info.rank);
+            return nullptr;
+        }
+        touched[i] = { rank_info, true, nullptr };
+    }
+
+    // Each link is made from the end with the lower index, so neighbors
+    // must list both ends of a link.  Components on other ranks that
+    // connect to this one are built as ghosts.
+    std::vector<GeneratorEdge> edges;
+    std::vector<uint64_t>      ghosts;
+    for ( size_t n = 0; ok && n < local.size(); n++ ) {
+        const uint64_t i = local[n];
+        ok               = getGeneratorEdges(neighbors, i, count, edges, [&](uint64_t j) {
+            if ( ok && !touched.count(j) ) {
+                RankInfo rank_info;
+                ok = rankOf(j, rank_info);
+                touched[j] = { rank_info, false, nullptr };
+                ghosts.push_back(j);
+            }
+            return j >= i;
+        });
+    }
+    for ( size_t n = 0; ok && n < ghosts.size(); n++ ) {
+        const uint64_t i = ghosts[n];
+        ok               = getGeneratorEdges(neighbors, i, count, edges, [&](uint64_t j) {
+            auto iter = touched.find(j);
+            return j > i && iter != touched.end() && iter->second.local;
+        });
+    }
+
+    // Build the components in order, giving component i the same ID on
+    // every rank
+    ConfigGraph*        graph = gModel->getGraph();
+    const ComponentId_t base  = graph->getNextComponentId();
+    uint64_t            built = 0;
+    for ( auto iter = touched.begin(); ok && iter != touched.end(); ++iter ) {
+        const uint64_t i = iter->first;
+        graph->setNextComponentId(base + i);
+        PyObject* comp     = PyObject_CallFunction(build, "K", (unsigned long long)i);
+        iter->second.comp = comp;
+        if ( nullptr == comp ) { ok = false; }
+        else if (
+            !PyObject_TypeCheck(comp, &PyModel_ComponentType) || ((ComponentPy_t*)comp)->obj->id != base + i ||
+            graph->getNextComponentId() != base + i + 1 ) {
+            PyErr_Format(
+                PyExc_RuntimeError, "generate(): build(%llu) must create and return exactly one Component",
+                (unsigned long long)i);
+            ok = false;
+        }
+        else {
+            graph->findComponent(base + i)->setRank(iter->second.rank);
+            built++;
+        }
+    }
+    if ( ok ) graph->setNextComponentId(base + count);
+
+    for ( GeneratorEdge& edge : edges ) {
+        if ( ok ) {
+            PyObject* head = Py_BuildValue(
+                "(KOKO)", (unsigned long long)edge.i, touched[edge.i].comp, (unsigned long long)edge.j,
+                touched[edge.j].comp);
+            PyObject* call = head ? PySequence_Concat(head, edge.extra) : nullptr;
+            PyObject* res  = call ? PyObject_CallObject(connect, call) : nullptr;
+            ok             = res != nullptr;
+            Py_XDECREF(res);
+            Py_XDECREF(call);
+            Py_XDECREF(head);
+        }
+        Py_DECREF(edge.extra);
+    }
+    for ( auto& kv : touched ) {
+        Py_XDECREF(kv.second.comp);
+    }
+
+    if ( !ok ) return nullptr;
+    return SST_ConvertToPythonLong(built);
+}
+
 static PyMethodDef sstModuleMethods[] = {
     { "setProgramOption", setProgramOption, METH_VARARGS,
       "Sets a single program configuration option (form:  setProgramOption(name, value))" },
@@ -940,6 +1217,13 @@ static PyMethodDef sstModuleMethods[] = {
       "Sets the statistic load level for the specified component name." },
     { "setStatisticLoadLevelForComponentType", setStatisticLoadLevelForComponentType, METH_VARARGS,
       "Sets the statistic load level for all components of the specified type." },
+    { "generate", generate, METH_VARARGS,
+      "Generates count components (form: generate(count, build, neighbors, connect[, rank[, local]])).  build(i) "
+      "creates and returns component i, neighbors(i) returns the indices (or tuples starting with the index) of the "
+      "components linked to i, and connect(i, comp_i, j, comp_j, ...) creates the links.  rank(i) returns the rank or "
+      "(rank, thread) of component i, and local(rank) returns the indices of the components rank(i) puts on rank.  "
+      "With parallel load, each rank only builds its own components and the ones linked to them.  Giving rank "
+      "without local makes every rank call rank(i) for every component." },
     { "findComponentByName", findComponentByName, METH_O,
       "Looks up to find a previously created component/subcomponent, based off of its name.  Returns None if none "
       "are to be found." },
@@ -42,6 +42,12 @@ SSTModelDescription::insertGlobalParameter(
     Params::insert_global(set, key, value, overwrite);
 }
 
+void
+SSTModelDescription::serializeParamKeyMaps(SST::Core::Serialization::serializer& ser)
+{
+    Params::serializeKeyMaps(ser);
+}
+
 
 bool
 SSTModelDescription::isElementParallelCapable(const std::string& type)
@@ -79,6 +79,15 @@ protected:
     void insertGlobalParameter(
         const std::string& set, const Params::key_type& key, const Params::key_type& value, bool overwrite = true);
 
+    /**
+     * Allows ModelDefinition to restore the table of parameter keys
+     * and the global param sets saved along with serialized Params.
+     * This replaces any keys and global param sets already defined.
+     *
+     * @param ser Serializer to use
+     */
+    void serializeParamKeyMaps(SST::Core::Serialization::serializer& ser);
+
 
 private:
     Config* config;
@@ -21,6 +21,7 @@ DISABLE_WARN_MISSING_OVERRIDE
 REENABLE_WARNING
 #endif
 
+#include <algorithm>
 #include <memory>
 #include <typeinfo>
 
@@ -109,6 +110,45 @@ recv(int src, int tag, dataType& data)
     Comms::deserialize(buffer.get(), size, data);
 }
 
+// Send send_data to dest and receive recv_data from src.  Safe to use
+// when every rank sends to one rank and receives from another, as in
+// a shift, since the receives are posted before the sends.
+template <typename dataType>
+void
+sendrecv(int dest, dataType& send_data, int src, dataType& recv_data, int tag)
+{
+    // Serialize the data
+    std::vector<char> send_buffer = Comms::serialize<dataType>(send_data);
+
+    // Exchange sizes first, then payloads
+    int64_t    send_size = send_buffer.size();
+    int64_t    recv_size = 0;
+    MPI_Status status;
+    MPI_Sendrecv(
+        &send_size, 1, MPI_INT64_T, dest, tag, &recv_size, 1, MPI_INT64_T, src, tag, MPI_COMM_WORLD, &status);
+
+    auto    recv_buffer   = std::unique_ptr<char[]>(new char[recv_size]);
+    int32_t fragment_size = 1000000000;
+
+    std::vector<MPI_Request> requests;
+    for ( int64_t offset = 0; offset < recv_size; offset += fragment_size ) {
+        MPI_Request request;
+        MPI_Irecv(
+            recv_buffer.get() + offset, std::min<int64_t>(fragment_size, recv_size - offset), MPI_BYTE, src, tag,
+            MPI_COMM_WORLD, &request);
+        requests.push_back(request);
+    }
+    for ( int64_t offset = 0; offset < send_size; offset += fragment_size ) {
+        MPI_Send(
+            send_buffer.data() + offset, std::min<int64_t>(fragment_size, send_size - offset), MPI_BYTE, dest, tag,
+            MPI_COMM_WORLD);
+    }
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+    // Now deserialize data
+    Comms::deserialize(recv_buffer.get(), recv_size, recv_data);
+}
+
 template <typename dataType>
 void
 all_gather(dataType& data, std::vector<dataType>& out_data)
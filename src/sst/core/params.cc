@@ -280,6 +280,18 @@ Params::getKey(const std::string& str)
     return i->second;
 }
 
+void
+Params::remapKeys(const std::vector<std::string>& key_names)
+{
+    std::map<uint32_t, std::string> remapped;
+    for ( auto& value : my_data ) {
+        // ID 0 is reserved, so it is the same everywhere
+        uint32_t key  = value.first == 0 ? 0 : getKey(key_names[value.first]);
+        remapped[key] = std::move(value.second);
+    }
+    my_data.swap(remapped);
+}
+
 void
 Params::addGlobalParamSet(const std::string& set)
 {
@@ -442,6 +454,15 @@ Params::getSubscribedGlobalParamSets() const
     return ret;
 }
 
+void
+Params::serializeKeyMaps(SST::Core::Serialization::serializer& ser)
+{
+    ser& keyMap;
+    ser& keyMapReverse;
+    ser& nextKeyID;
+    ser& global_params;
+}
+
 #if 0
  template<>
  uint32_t Params::find(const std::string& k) const
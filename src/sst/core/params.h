@@ -919,6 +919,16 @@ private:
      */
     std::vector<std::string> getSubscribedGlobalParamSets() const;
 
+    /**
+     * Serialize the table of parameter keys and the global param
+     * sets.  Serialized Params only hold the key IDs, so the table
+     * has to be saved along with them for the Params to be read back
+     * in another process.
+     *
+     * @param ser Serializer to use
+     */
+    static void serializeKeyMaps(SST::Core::Serialization::serializer& ser);
+
 
     // Private functions used by Params
     /**
@@ -937,6 +947,15 @@ private:
 
     static uint32_t getKey(const std::string& str);
 
+    /**
+     * Translate the keys of the local parameters, which were created
+     * by a process whose key names are key_names, to the keys of this
+     * process.  Used when moving parameters between ranks that loaded
+     * the model in parallel, since each rank numbers its own keys.
+     * @param key_names  Key names of the other process, indexed by key ID
+     */
+    void remapKeys(const std::vector<std::string>& key_names);
+
     /**
      * Given a Parameter Key ID, return the Name of the matching parameter
      * @param id  Key ID to look up
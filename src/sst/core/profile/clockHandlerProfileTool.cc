@@ -78,7 +78,13 @@ ClockHandlerProfileToolCount::registerHandler(const HandlerMetaData& mdata)
 void
 ClockHandlerProfileToolCount::handlerStart(uintptr_t key)
 {
-    (*reinterpret_cast<uint64_t*>(key))++;
+    reinterpret_cast<clock_count_t*>(key)->count++;
+}
+
+void
+ClockHandlerProfileToolCount::handlerSkipped(uintptr_t key, uint64_t count)
+{
+    reinterpret_cast<clock_count_t*>(key)->skipped += count;
 }
 
 
@@ -86,9 +92,9 @@ void
 ClockHandlerProfileToolCount::outputData(FILE* fp)
 {
     fprintf(fp, "%s\n", name.c_str());
-    fprintf(fp, "Name, count\n");
+    fprintf(fp, "Name, count, skipped\n");
     for ( auto& x : counts_ ) {
-        fprintf(fp, "%s, %" PRIu64 "\n", x.first.c_str(), x.second);
+        fprintf(fp, "%s, %" PRIu64 ", %" PRIu64 "\n", x.first.c_str(), x.second.count, x.second.skipped);
     }
 }
 
@@ -105,16 +111,27 @@ ClockHandlerProfileToolTime<T>::registerHandler(const HandlerMetaData& mdata)
     return reinterpret_cast<uintptr_t>(&times_[getKeyForHandler(mdata)]);
 }
 
+template <typename T>
+void
+ClockHandlerProfileToolTime<T>::addHandlerTimes(std::map<std::string, std::pair<uint64_t, uint64_t>>& totals)
+{
+    for ( auto& x : times_ ) {
+        totals[x.first].first += x.second.time;
+        totals[x.first].second += x.second.count;
+    }
+}
+
 template <typename T>
 void
 ClockHandlerProfileToolTime<T>::outputData(FILE* fp)
 {
     fprintf(fp, "%s\n", name.c_str());
-    fprintf(fp, "Name, count, handler time (s), avg. handler time (ns)\n");
+    fprintf(fp, "Name, count, handler time (s), avg. handler time (ns), skipped\n");
     for ( auto& x : times_ ) {
         fprintf(
-            fp, "%s, %" PRIu64 ", %lf, %" PRIu64 "\n", x.first.c_str(), x.second.count,
-            ((double)x.second.time) / 1000000000.0, x.second.count == 0 ? 0 : x.second.time / x.second.count);
+            fp, "%s, %" PRIu64 ", %lf, %" PRIu64 ", %" PRIu64 "\n", x.first.c_str(), x.second.count,
+            ((double)x.second.time) / 1000000000.0, x.second.count == 0 ? 0 : x.second.time / x.second.count,
+            x.second.skipped);
     }
 }
 
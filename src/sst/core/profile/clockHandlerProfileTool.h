@@ -48,7 +48,8 @@ protected:
 
 /**
    Profile tool that will count the number of times a handler is
-   called
+   called, and the number of cycles it was skipped while its clock
+   was gated
  */
 class ClockHandlerProfileToolCount : public ClockHandlerProfileTool
 {
@@ -70,10 +71,20 @@ public:
 
     void handlerStart(uintptr_t key) override;
 
+    void handlerSkipped(uintptr_t key, uint64_t count) override;
+
     void outputData(FILE* fp) override;
 
 private:
-    std::map<std::string, uint64_t> counts_;
+    struct clock_count_t
+    {
+        uint64_t count;
+        uint64_t skipped;
+
+        clock_count_t() : count(0), skipped(0) {}
+    };
+
+    std::map<std::string, clock_count_t> counts_;
 };
 
 /**
@@ -87,8 +98,9 @@ class ClockHandlerProfileToolTime : public ClockHandlerProfileTool
     {
         uint64_t time;
         uint64_t count;
+        uint64_t skipped;
 
-        clock_data_t() : time(0), count(0) {}
+        clock_data_t() : time(0), count(0), skipped(0) {}
     };
 
 public:
@@ -108,6 +120,13 @@ public:
         entry->count++;
     }
 
+    void handlerSkipped(uintptr_t key, uint64_t count) override
+    {
+        reinterpret_cast<clock_data_t*>(key)->skipped += count;
+    }
+
+    void addHandlerTimes(std::map<std::string, std::pair<uint64_t, uint64_t>>& totals) override;
+
     void outputData(FILE* fp) override;
 
 private:
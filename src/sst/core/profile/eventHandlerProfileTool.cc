@@ -124,6 +124,16 @@ EventHandlerProfileToolTime<T>::registerHandler(const HandlerMetaData& mdata)
     return reinterpret_cast<uintptr_t>(&times_[getKeyForHandler(mdata)]);
 }
 
+template <typename T>
+void
+EventHandlerProfileToolTime<T>::addHandlerTimes(std::map<std::string, std::pair<uint64_t, uint64_t>>& totals)
+{
+    for ( auto& x : times_ ) {
+        totals[x.first].first += x.second.recv_time;
+        totals[x.first].second += x.second.recv_count;
+    }
+}
+
 template <typename T>
 void
 EventHandlerProfileToolTime<T>::outputData(FILE* fp)
@@ -132,6 +132,8 @@ public:
 
     void eventSent(uintptr_t key, Event* UNUSED(ev)) override { reinterpret_cast<event_data_t*>(key)->send_count++; }
 
+    void addHandlerTimes(std::map<std::string, std::pair<uint64_t, uint64_t>>& totals) override;
+
     void outputData(FILE* fp) override;
 
 private:
@@ -33,11 +33,20 @@ SyncProfileToolCount::syncManagerStart()
 }
 
 
+void
+SyncProfileToolCount::rankSync(uint64_t rounds_saved)
+{
+    ranksync_count++;
+    rounds_saved_ += rounds_saved;
+}
+
 void
 SyncProfileToolCount::outputData(FILE* fp)
 {
     fprintf(fp, "%s\n", name.c_str());
     fprintf(fp, "  SyncManager Count = %" PRIu64 "\n", syncmanager_count);
+    fprintf(fp, "  RankSync Count = %" PRIu64 "\n", ranksync_count);
+    fprintf(fp, "  RankSync Rounds Saved = %" PRIu64 "\n", rounds_saved_);
 }
 
 
@@ -53,6 +62,8 @@ SyncProfileToolTime<T>::outputData(FILE* fp)
     fprintf(fp, "  SyncManager Count = %" PRIu64 "\n", syncmanager_count);
     fprintf(fp, "  Total SyncManager Time = %lfs\n", (float)syncmanager_time / 1000000000.0);
     fprintf(fp, "  Average SyncManager Time = %" PRIu64 "ns\n", syncmanager_time / syncmanager_count);
+    fprintf(fp, "  Barrier Wait Count = %" PRIu64 "\n", barrier_count);
+    fprintf(fp, "  Total Barrier Wait Time = %lfs\n", (float)barrier_time / 1000000000.0);
 }
 
 
@@ -40,6 +40,16 @@ public:
 
     virtual void syncManagerStart() {}
     virtual void syncManagerEnd() {}
+
+    /** Called at each rank sync with the number of syncs that were
+     * avoided since the last rank sync, compared to syncing every
+     * minimum partition latency */
+    virtual void rankSync(uint64_t UNUSED(rounds_saved)) {}
+
+    /** Called before and after each wait on a thread barrier in the
+     * SyncManager */
+    virtual void barrierStart() {}
+    virtual void barrierEnd() {}
 };
 
 
@@ -66,10 +76,14 @@ public:
 
     void syncManagerStart() override;
 
+    void rankSync(uint64_t rounds_saved) override;
+
     void outputData(FILE* fp) override;
 
 private:
     uint64_t syncmanager_count = 0;
+    uint64_t ranksync_count    = 0;
+    uint64_t rounds_saved_     = 0;
 };
 
 /**
@@ -93,13 +107,25 @@ public:
         syncmanager_count++;
     }
 
+    void barrierStart() override { barrier_start_time_ = T::now(); }
+
+    void barrierEnd() override
+    {
+        auto total_time = T::now() - barrier_start_time_;
+        barrier_time += std::chrono::duration_cast<std::chrono::nanoseconds>(total_time).count();
+        barrier_count++;
+    }
+
     void outputData(FILE* fp) override;
 
 private:
     uint64_t syncmanager_time  = 0;
     uint64_t syncmanager_count = 0;
+    uint64_t barrier_time      = 0;
+    uint64_t barrier_count     = 0;
 
     typename T::time_point start_time_;
+    typename T::time_point barrier_start_time_;
 };
 
 } // namespace Profile
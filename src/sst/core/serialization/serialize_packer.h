@@ -15,6 +15,7 @@
 #include "sst/core/serialization/serialize_buffer_accessor.h"
 
 #include <string>
+#include <vector>
 
 namespace SST {
 namespace Core {
@@ -24,13 +25,45 @@ namespace pvt {
 class ser_packer : public ser_buffer_accessor
 {
 public:
+    ser_packer() : ser_buffer_accessor(), growable_(nullptr), offset_(0) {}
+
     template <class T>
     void pack(T& t)
     {
-        T* buf = ser_buffer_accessor::next<T>();
+        T* buf = next<T>();
         *buf   = t;
     }
 
+    template <class T>
+    T* next()
+    {
+        if ( growable_ && size_ + sizeof(T) > max_size_ ) grow(sizeof(T));
+        return ser_buffer_accessor::next<T>();
+    }
+
+    char* next_str(size_t size)
+    {
+        if ( growable_ && size_ + size > max_size_ ) grow(size);
+        return ser_buffer_accessor::next_str(size);
+    }
+
+    /** Pack into a fixed size buffer */
+    void init(void* buffer, size_t size)
+    {
+        growable_ = nullptr;
+        offset_   = 0;
+        ser_buffer_accessor::init(buffer, size);
+    }
+
+    /**
+     * Pack into buffer starting at offset.  The vector is resized in
+     * chunks as the data is packed and is never shrunk, so a vector
+     * that is reused will stop growing once it reaches its steady
+     * state size.  Pointers into the buffer are invalidated whenever
+     * it grows.
+     */
+    void init(std::vector<char>& buffer, size_t offset);
+
     /**
      * @brief pack_buffer
      * @param buf  Must be non-null
@@ -39,6 +72,12 @@ public:
     void pack_buffer(void* buf, int size);
 
     void pack_string(std::string& str);
+
+private:
+    void grow(size_t needed);
+
+    std::vector<char>* growable_;
+    size_t             offset_;
 };
 
 } // namespace pvt
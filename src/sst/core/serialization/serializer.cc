@@ -16,6 +16,8 @@
 #include "sst/core/output.h"
 #include "sst/core/serialization/serializable.h"
 
+#include <algorithm>
+
 namespace SST {
 namespace Core {
 namespace Serialization {
@@ -46,6 +48,32 @@ ser_packer::pack_buffer(void* buf, int size)
     ::memcpy(charstr, buf, size);
 }
 
+// Growable buffers are sized in multiples of this
+static constexpr size_t ser_packer_grow_chunk = 4096;
+
+void
+ser_packer::init(std::vector<char>& buffer, size_t offset)
+{
+    if ( buffer.size() < offset + ser_packer_grow_chunk ) buffer.resize(offset + ser_packer_grow_chunk);
+    growable_ = &buffer;
+    offset_   = offset;
+    ser_buffer_accessor::init(buffer.data() + offset, buffer.size() - offset);
+}
+
+void
+ser_packer::grow(size_t needed)
+{
+    // Double the buffer, or more if that isn't enough, rounded up to
+    // a whole number of chunks
+    size_t new_size = std::max(growable_->size() * 2, offset_ + size_ + needed);
+    new_size        = (new_size + ser_packer_grow_chunk - 1) / ser_packer_grow_chunk * ser_packer_grow_chunk;
+    growable_->resize(new_size);
+
+    bufstart_ = growable_->data() + offset_;
+    bufptr_   = bufstart_ + size_;
+    max_size_ = new_size - offset_;
+}
+
 void
 ser_unpacker::unpack_string(std::string& str)
 {
@@ -170,6 +170,17 @@ public:
         mode_ = PACK;
     }
 
+    /**
+     * Start packing into a growable buffer, beginning at offset.  No
+     * sizing pass is needed, the buffer is resized as data is packed.
+     * Use size() to get the number of bytes packed.
+     */
+    void start_packing(std::vector<char>& buffer, size_t offset = 0)
+    {
+        packer_.init(buffer, offset);
+        mode_ = PACK;
+    }
+
     void start_sizing()
     {
         sizer_.reset();
@@ -20,6 +20,7 @@
 #include "sst/core/exit.h"
 #include "sst/core/factory.h"
 #include "sst/core/heartbeat.h"
+#include "sst/core/impl/timevortex/timeVortexFifo.h"
 #include "sst/core/linkMap.h"
 #include "sst/core/linkPair.h"
 #include "sst/core/output.h"
@@ -38,6 +39,7 @@
 #include "sst/core/unitAlgebra.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <utility>
 
@@ -138,14 +140,22 @@ Simulation_impl::~Simulation_impl()
 Simulation_impl*
 Simulation_impl::createSimulation(Config* config, RankInfo my_rank, RankInfo num_ranks)
 {
-    std::thread::id  tid      = std::this_thread::get_id();
-    Simulation_impl* instance = new Simulation_impl(config, my_rank, num_ranks);
+    std::thread::id tid = std::this_thread::get_id();
+    instance            = new Simulation_impl(config, my_rank, num_ranks);
 
     std::lock_guard<std::mutex> lock(simulationMutex);
     instanceMap[tid] = instance;
     instanceVec.resize(num_ranks.thread);
     instanceVec[my_rank.thread] = instance;
     instance->intializeProfileTools(config->enabledProfiling());
+    if ( config->outputComponentWeights() != "" ) {
+        // Time the handlers of each component with the standard
+        // profile tools
+        instance->intializeProfileTools(
+            "component_weights_clock:sst.profile.handler.clock.time.steady(level=component)[clock];"
+            "component_weights_event:sst.profile.handler.event.time.steady(level=component)[event]");
+        instance->component_weight_tools = { "component_weights_clock", "component_weights_event" };
+    }
     return instance;
 }
 
@@ -153,6 +163,7 @@ void
 Simulation_impl::shutdown()
 {
     instanceMap.clear();
+    instance = nullptr;
     // Done with sync object, delete it
     delete Simulation_impl::m_exit;
 }
@@ -160,9 +171,11 @@ Simulation_impl::shutdown()
 Simulation_impl::Simulation_impl(Config* cfg, RankInfo my_rank, RankInfo num_ranks) :
     Simulation(),
     timeVortex(nullptr),
+    link_fifo(nullptr),
     interThreadMinLatency(MAX_SIMTIME_T),
     endSim(false),
     untimed_phase(0),
+    untimed_quiescence(cfg->untimed_quiescence()),
     lastRecvdSignal(0),
     shutdown_mode(SHUTDOWN_CLEAN),
     wireUpFinished(false),
@@ -183,10 +196,23 @@ Simulation_impl::Simulation_impl(Config* cfg, RankInfo my_rank, RankInfo num_ran
     output_directory = cfg->output_directory();
     Params p;
     // params get passed twice - both the params and a ctor argument
-    direct_interthread = cfg->interthread_links();
+    direct_interthread  = cfg->interthread_links();
+    shared_memory_ranks = cfg->shared_memory_ranks();
+    async_rank_sync     = cfg->async_rank_sync();
+    per_peer_lookahead  = cfg->per_peer_lookahead();
     std::string timevortex_type(cfg->timeVortex());
     if ( direct_interthread && num_ranks.thread > 1 ) timevortex_type = timevortex_type + ".ts";
     timeVortex = factory->Create<TimeVortex>(timevortex_type, p);
+    if ( cfg->fifo_links() ) {
+        // FIFO events are ordered against the TimeVortex's events by
+        // its insertion count
+        if ( !timeVortex->supportsQueueOrder() ) {
+            sim_output.fatal(
+                CALL_INFO, 1, "ERROR: --fifo-links cannot be used with TimeVortex %s\n", timevortex_type.c_str());
+        }
+        link_fifo  = new IMPL::TimeVortexFifo(timeVortex);
+        timeVortex = link_fifo;
+    }
     if ( my_rank.thread == 0 ) { m_exit = new Exit(num_ranks.thread, num_ranks.rank == 1); }
 
     if ( cfg->heartbeatPeriod() != "" && my_rank.thread == 0 ) {
@@ -522,19 +548,30 @@ Simulation_impl::initialize()
     initBarrier.wait();
     if ( my_rank.thread == 0 ) { SharedObject::manager.updateState(false); }
 
+    if ( untimed_quiescence ) {
+        untimed_comps.assign(compInfoMap.begin(), compInfoMap.end());
+        untimed_pending.assign(untimed_comps.size(), { { false, false } });
+        for ( size_t i = 0; i < untimed_comps.size(); i++ ) {
+            untimed_comps[i]->untimed_pending = untimed_pending[i].data();
+            untimed_comps[i]->watchUntimedData(untimed_pending[i].data());
+        }
+    }
+
     do {
         initBarrier.wait();
-        if ( my_rank.thread == 0 ) untimed_msg_count = 0;
+        if ( my_rank.thread == 0 ) {
+            untimed_msg_count  = 0;
+            untimed_call_count = 0;
+        }
         initBarrier.wait();
 
-        for ( auto iter = compInfoMap.begin(); iter != compInfoMap.end(); ++iter ) {
-            // printf("Calling init on %s: %p\n",(*iter)->getName().c_str(),(*iter)->getComponent());
-            (*iter)->getComponent()->init(untimed_phase);
-        }
+        double phase_start = sst_get_cpu_time();
+        untimed_call_count += callUntimedPhase(true);
 
         initBarrier.wait();
         syncManager->exchangeLinkUntimedData(untimed_msg_count);
         initBarrier.wait();
+        reportUntimedPhase("Init", phase_start);
         // We're done if no new messages were sent
         if ( untimed_msg_count == 0 ) done = true;
         if ( my_rank.thread == 0 ) { SharedObject::manager.updateState(false); }
@@ -572,21 +609,29 @@ Simulation_impl::complete()
 
     syncManager->prepareForComplete();
 
+    // Requests left over from init don't carry over
+    for ( auto& pending : untimed_pending ) {
+        pending.fill(false);
+    }
+
     bool done = false;
     completeBarrier.wait();
 
     do {
         completeBarrier.wait();
-        if ( my_rank.thread == 0 ) untimed_msg_count = 0;
+        if ( my_rank.thread == 0 ) {
+            untimed_msg_count  = 0;
+            untimed_call_count = 0;
+        }
         completeBarrier.wait();
 
-        for ( auto iter = compInfoMap.begin(); iter != compInfoMap.end(); ++iter ) {
-            (*iter)->getComponent()->complete(untimed_phase);
-        }
+        double phase_start = sst_get_cpu_time();
+        untimed_call_count += callUntimedPhase(false);
 
         completeBarrier.wait();
         syncManager->exchangeLinkUntimedData(untimed_msg_count);
         completeBarrier.wait();
+        reportUntimedPhase("Complete", phase_start);
         // We're done if no new messages were sent
         if ( untimed_msg_count == 0 ) done = true;
 
@@ -595,6 +640,54 @@ Simulation_impl::complete()
     complete_phase_total_time = sst_get_cpu_time() - complete_phase_start_time;
 }
 
+int
+Simulation_impl::callUntimedPhase(bool init)
+{
+    auto call = [this, init](ComponentInfo* info) {
+        if ( init )
+            info->getComponent()->init(untimed_phase);
+        else
+            info->getComponent()->complete(untimed_phase);
+    };
+
+    int called = 0;
+    if ( !untimed_quiescence ) {
+        for ( auto iter = compInfoMap.begin(); iter != compInfoMap.end(); ++iter ) {
+            call(*iter);
+            called++;
+        }
+        return called;
+    }
+
+    for ( size_t i = 0; i < untimed_comps.size(); i++ ) {
+        // Every Component is called in phase 0.  After that, only the
+        // ones with untimed data waiting or that asked for it.
+        bool& pending = untimed_pending[i][untimed_phase & 1];
+        if ( !pending && untimed_phase != 0 ) continue;
+        pending = false;
+        call(untimed_comps[i]);
+        called++;
+    }
+    return called;
+}
+
+void
+Simulation_impl::reportUntimedPhase(const char* name, double start)
+{
+    if ( my_rank.rank != 0 || my_rank.thread != 0 ) return;
+    sim_output.verbose(
+        CALL_INFO, 1, 0, "# %s phase %u: %d untimed messages, %d components called on rank 0, %f seconds\n", name,
+        untimed_phase, (int)untimed_msg_count, (int)untimed_call_count, sst_get_cpu_time() - start);
+}
+
+void
+Simulation_impl::requestUntimedPhase(ComponentInfo* info)
+{
+    while ( info->parent_info != nullptr )
+        info = info->parent_info;
+    if ( info->untimed_pending ) info->untimed_pending[(untimed_phase + 1) & 1] = true;
+}
+
 void
 Simulation_impl::setup()
 {
@@ -1238,7 +1331,7 @@ Simulation_impl::printProfilingInfo(FILE* fp)
 {
     // If no profile tools are installed, return without doing
     // anything
-    if ( profile_tools.size() == 0 ) return;
+    if ( profile_tools.size() == component_weight_tools.size() ) return;
 
     // Print out a header if printing to stdout
     if ( fp == stdout && my_rank.rank == 0 && my_rank.thread == 0 ) {
@@ -1251,9 +1344,13 @@ Simulation_impl::printProfilingInfo(FILE* fp)
     fprintf(fp, "Rank = %" PRIu32 ", thread = %" PRIu32 ":\n", my_rank.rank, my_rank.thread);
 
     for ( auto tool : profile_tools ) {
+        if ( std::find(component_weight_tools.begin(), component_weight_tools.end(), tool.first) !=
+             component_weight_tools.end() )
+            continue;
         fprintf(fp, "\n");
         tool.second->outputData(fp);
     }
+    syncManager->outputProfileData(fp);
 
     // Print footer if printing on stdout
     if ( fp == stdout && my_rank.rank == num_ranks.rank - 1 && my_rank.thread == num_ranks.thread - 1 ) {
@@ -1261,6 +1358,15 @@ Simulation_impl::printProfilingInfo(FILE* fp)
     }
 }
 
+void
+Simulation_impl::getComponentTimes(std::map<std::string, std::pair<uint64_t, uint64_t>>& times)
+{
+    for ( auto& name : component_weight_tools ) {
+        HandlerProfileToolAPI* tool = dynamic_cast<HandlerProfileToolAPI*>(profile_tools.at(name));
+        if ( tool ) tool->addHandlerTimes(times);
+    }
+}
+
 #if SST_PERFORMANCE_INSTRUMENTING
 void
 Simulation_impl::printPerformanceInfo()
@@ -1337,9 +1443,11 @@ TimeConverter*             Simulation_impl::minPartTC = nullptr;
 SimTime_t                  Simulation_impl::minPart;
 
 /* Define statics (Simulation) */
+thread_local Simulation_impl*                         Simulation_impl::instance = nullptr;
 std::unordered_map<std::thread::id, Simulation_impl*> Simulation_impl::instanceMap;
 std::vector<Simulation_impl*>                         Simulation_impl::instanceVec;
 std::atomic<int>                                      Simulation_impl::untimed_msg_count;
+std::atomic<int>                                      Simulation_impl::untimed_call_count;
 Exit*                                                 Simulation_impl::m_exit;
 
 } // namespace SST
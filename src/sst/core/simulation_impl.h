@@ -25,6 +25,7 @@
 #include "sst/core/statapi/statengine.h"
 #include "sst/core/unitAlgebra.h"
 
+#include <array>
 #include <atomic>
 #include <cstdio>
 #include <iostream>
@@ -61,6 +62,10 @@ class TimeVortex;
 class UnitAlgebra;
 class SharedRegionManager;
 
+namespace IMPL {
+class TimeVortexFifo;
+} // namespace IMPL
+
 namespace Statistics {
 class StatisticOutput;
 class StatisticProcessingEngine;
@@ -129,8 +134,9 @@ public:
 
     /*********  Static Core-only Functions *********/
 
-    /** Return a pointer to the singleton instance of the Simulation */
-    static Simulation_impl* getSimulation() { return instanceMap.at(std::this_thread::get_id()); }
+    /** Return a pointer to the singleton instance of the Simulation
+     * for the calling thread */
+    static Simulation_impl* getSimulation() { return instance; }
 
     /** Return the TimeLord associated with this Simulation */
     static TimeLord* getTimeLord(void) { return &timeLord; }
@@ -180,6 +186,10 @@ public:
     /** Perform the complete() phase of simulation */
     void complete();
 
+    /** Have the Component that info belongs to called in the next
+        untimed phase.  Only needed with --untimed-quiescence. */
+    void requestUntimedPhase(ComponentInfo* info);
+
     /** Perform the setup() and run phases of the simulation. */
     void setup();
 
@@ -196,6 +206,12 @@ public:
 
     void printProfilingInfo(FILE* fp);
 
+    /** Add the handler time (in ns) and number of handler calls of
+        each component to times.  Only recorded when
+        --output-component-weights is set.
+     */
+    void getComponentTimes(std::map<std::string, std::pair<uint64_t, uint64_t>>& times);
+
     void printPerformanceInfo();
 
     /** Register a OneShot event to be called after a time delay
@@ -327,11 +343,18 @@ public:
     static Core::ThreadSafe::Spinlock cross_thread_lock;
     static std::map<LinkId_t, Link*>  cross_thread_links;
     bool                              direct_interthread;
+    bool                              shared_memory_ranks;
+    bool                              async_rank_sync;
+    bool                              per_peer_lookahead;
 
     Component* createComponent(ComponentId_t id, const std::string& name, Params& params);
 
     TimeVortex* getTimeVortex() const { return timeVortex; }
 
+    /** Per-timestamp FIFOs for links within this thread, or nullptr
+     * if --fifo-links is not set.  This is also the TimeVortex. */
+    IMPL::TimeVortexFifo* getLinkFifo() const { return link_fifo; }
+
     /** Emergency Shutdown
      * Called when a SIGINT or SIGTERM has been seen
      */
@@ -341,6 +364,13 @@ public:
     void        endSimulation(void);
     void        endSimulation(SimTime_t end);
 
+    /** Call init() or complete() on the Components for the current
+        untimed phase.  Returns the number of Components called. */
+    int  callUntimedPhase(bool init);
+    /** Print the message count and time for the untimed phase that
+        just finished */
+    void reportUntimedPhase(const char* name, double start);
+
     typedef enum {
         SHUTDOWN_CLEAN,     /* Normal shutdown */
         SHUTDOWN_SIGNAL,    /* SIGINT or SIGTERM received */
@@ -350,6 +380,7 @@ public:
     friend class SyncManager;
 
     TimeVortex*             timeVortex;
+    IMPL::TimeVortexFifo*   link_fifo;
     TimeConverter*          threadMinPartTC;
     Activity*               current_activity;
     static SimTime_t        minPart;
@@ -366,7 +397,14 @@ public:
     bool                    endSim;
     bool                    independent; // true if no links leave thread (i.e. no syncs required)
     static std::atomic<int> untimed_msg_count;
+    static std::atomic<int> untimed_call_count;
     unsigned int            untimed_phase;
+    bool                    untimed_quiescence;
+    // With --untimed-quiescence, the Components on this thread and the
+    // flags each one's untimed_pending points to.  Scanning the flags
+    // is much cheaper than walking compInfoMap every phase.
+    std::vector<ComponentInfo*>      untimed_comps;
+    std::vector<std::array<bool, 2>> untimed_pending;
     volatile sig_atomic_t   lastRecvdSignal;
     ShutdownMode_t          shutdown_mode;
     bool                    wireUpFinished;
@@ -383,6 +421,11 @@ public:
 
     void intializeProfileTools(const std::string& config);
 
+    // Tools that time the handlers of each component for
+    // --output-component-weights.  They are not included in the
+    // profiling output.
+    std::vector<std::string> component_weight_tools;
+
     std::map<std::string, SST::Profile::ProfileTool*> profile_tools;
     // Maps the component profile points to profiler names
     std::map<std::string, std::vector<std::string>>   profiler_map;
@@ -499,6 +542,13 @@ public:
     double complete_phase_start_time;
     double complete_phase_total_time;
 
+    // Simulation instance for the current thread.  This is what
+    // getSimulation() returns, so no lookup is needed on the hot
+    // paths.
+    static thread_local Simulation_impl* instance;
+
+    // All instances, keyed by thread id.  Only used to register the
+    // instances and for debugging.
     static std::unordered_map<std::thread::id, Simulation_impl*> instanceMap;
     static std::vector<Simulation_impl*>                         instanceVec;
 
@@ -144,7 +144,7 @@ public:
     {
         data.swap(new_data);
         if ( !sorted ) {
-            std::sort(data.begin(), data.end, [](const classT& lhs, const classT& rhs) -> bool {
+            std::sort(data.begin(), data.end(), [](const classT& lhs, const classT& rhs) -> bool {
                 return lhs.key() < rhs.key();
             });
         }
@@ -401,7 +401,7 @@ public:
     {
         data.swap(new_data);
         if ( !sorted ) {
-            std::sort(data.begin(), data.end, [](const classT* lhs, const classT* rhs) -> bool {
+            std::sort(data.begin(), data.end(), [](const classT* lhs, const classT* rhs) -> bool {
                 return lhs->key() < rhs->key();
             });
         }
@@ -678,7 +678,7 @@ public:
     {
         data.swap(new_data);
         if ( !sorted ) {
-            std::sort(data.begin(), data.end, [](const keyT& lhs, const keyT& rhs) -> bool { return lhs < rhs; });
+            std::sort(data.begin(), data.end(), [](const keyT& lhs, const keyT& rhs) -> bool { return lhs < rhs; });
         }
     }
 
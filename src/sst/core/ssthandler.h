@@ -15,6 +15,10 @@
 #include "sst/core/profile/profiletool.h"
 #include "sst/core/sst_types.h"
 
+#include <map>
+#include <string>
+#include <utility>
+
 namespace SST {
 
 class Params;
@@ -46,6 +50,19 @@ public:
 
     virtual void handlerStart(uintptr_t UNUSED(key)) {}
     virtual void handlerEnd(uintptr_t UNUSED(key)) {}
+
+    /**
+       Called when a clock handler was not called for count cycles
+       because its component gated the clock
+     */
+    virtual void handlerSkipped(uintptr_t UNUSED(key), uint64_t UNUSED(count)) {}
+
+    /**
+       Add the time (in ns) and number of calls of the handlers for
+       each key to totals.  Only tools that time the handlers have
+       anything to add.
+     */
+    virtual void addHandlerTimes(std::map<std::string, std::pair<uint64_t, uint64_t>>& UNUSED(totals)) {}
 };
 
 // This file contains base classes for use as various handlers (object
@@ -109,6 +126,11 @@ protected:
             for ( auto& x : tools )
                 x.first->handlerEnd(x.second);
         }
+        void handlerSkipped(uint64_t count)
+        {
+            for ( auto& x : tools )
+                x.first->handlerSkipped(x.second, count);
+        }
 
         /**
            Adds a profile tool the the list and registers this handler
@@ -120,6 +142,14 @@ protected:
             tools.push_back(std::make_pair(tool, key));
         }
 
+        /** Returns true if tool is already in the list */
+        bool hasProfileTool(HandlerProfileToolAPI* tool) const
+        {
+            for ( auto& x : tools )
+                if ( x.first == tool ) return true;
+            return false;
+        }
+
         HandlerId_t getId() { return my_id; }
 
     private:
@@ -144,6 +174,21 @@ public:
         profile_tools->addProfileTool(tool, mdata);
     }
 
+    /** Returns true if tool has been added to this handler */
+    bool hasProfileTool(HandlerProfileToolAPI* tool) const
+    {
+        return profile_tools && profile_tools->hasProfileTool(tool);
+    }
+
+    /**
+       Tell the profiling tools that the handler was skipped count
+       times
+    */
+    void handlerSkipped(uint64_t count)
+    {
+        if ( profile_tools ) profile_tools->handlerSkipped(count);
+    }
+
     void transferProfilingInfo(SSTHandlerBaseProfile* handler)
     {
         if ( handler->profile_tools ) {
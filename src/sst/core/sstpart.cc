@@ -33,5 +33,12 @@ SSTPartitioner::performPartition(ConfigGraph* UNUSED(graph))
     output.fatal(CALL_INFO, 1, "ERROR: chosen partitioner does not support ConfigGraph");
 }
 
+void
+SSTPartitioner::performParallelPartition(ConfigGraph* UNUSED(graph))
+{
+    Output& output = Output::getDefaultObject();
+    output.fatal(CALL_INFO, 1, "ERROR: chosen partitioner does not support parallel loading");
+}
+
 } // namespace Partition
 } // namespace SST
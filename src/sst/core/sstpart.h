@@ -59,9 +59,29 @@ public:
      */
     virtual void performPartition(ConfigGraph* graph);
 
+    /** Function to be overridden by subclasses that return true from
+     * supportsParallelLoad()
+     *
+     * Refines the partition of a graph loaded in parallel.  Called on
+     * every rank, each of which only has the components the model
+     * placed on it and ghosts of the components they link to.
+     *
+     * Result of this function is that every ConfigComponent in
+     * graph, including the ghosts, has its new Rank applied to it.
+     */
+    virtual void performParallelPartition(ConfigGraph* graph);
+
     virtual bool requiresConfigGraph() { return false; }
 
+    virtual bool supportsParallelLoad() { return false; }
+
     virtual bool spawnOnAllRanks() { return false; }
+
+    /** Set how much heavier than the average the heaviest rank may
+     * be, as a fraction of the average.  Only used by partitioners
+     * that trade balance for a better cut; the rest ignore it.
+     */
+    virtual void setImbalanceTolerance(double UNUSED(tolerance)) {}
     // virtual bool supportsPartialPartitionInput() { return false; }
 };
 
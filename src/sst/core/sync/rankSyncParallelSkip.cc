@@ -66,6 +66,14 @@ RankSyncParallelSkip::RankSyncParallelSkip(RankInfo num_ranks, TimeConverter* UN
         recv_count[i] = 0;
     }
     link_send_queue = new SST::Core::ThreadSafe::UnboundedQueue<comm_recv_pair*>[num_ranks.thread];
+    num_threads     = num_ranks.thread;
+
+    async = Simulation_impl::getSimulation()->async_rank_sync;
+#ifdef SST_CONFIG_HAVE_MPI
+    send_req_count   = 0;
+    recvs_posted     = false;
+    min_time_pending = false;
+#endif
 }
 
 RankSyncParallelSkip::~RankSyncParallelSkip()
@@ -134,11 +142,47 @@ RankSyncParallelSkip::finalizeLinkConfigurations()
     deserialize_queue.initialize(comm_recv_map.size());
     serialize_queue.initialize(comm_send_map.size());
     send_queue.initialize(comm_send_map.size());
+
+#ifdef SST_CONFIG_HAVE_MPI
+    // Maximum number of outstanding send requests is 2 per rank we
+    // send to (header and data)
+    send_reqs.resize(2 * comm_send_map.size());
+    for ( auto i = comm_recv_map.begin(); i != comm_recv_map.end(); ++i ) {
+        recv_pairs.push_back(&(i->second));
+    }
+    recv_reqs.resize(recv_pairs.size(), MPI_REQUEST_NULL);
+    recv_indices.resize(recv_pairs.size());
+#endif
 }
 
 void
 RankSyncParallelSkip::prepareForComplete()
-{}
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // Clean up anything left outstanding by an asynchronous exchange
+    // so the untimed data exchange can use the receive buffers
+    waitSends();
+    if ( recvs_posted ) {
+        for ( auto& req : recv_reqs ) {
+            if ( req != MPI_REQUEST_NULL ) MPI_Cancel(&req);
+        }
+        MPI_Waitall(recv_reqs.size(), recv_reqs.data(), MPI_STATUSES_IGNORE);
+        recvs_posted = false;
+    }
+    if ( min_time_pending ) {
+        MPI_Wait(&min_time_req, MPI_STATUS_IGNORE);
+        min_time_pending = false;
+    }
+#endif
+}
+
+void
+RankSyncParallelSkip::outputProfileData(FILE* fp)
+{
+    fprintf(
+        fp, "RankSyncParallelSkip (%s)\n  mpiWait: %lg sec  deserializeWait:  %lg sec\n",
+        async ? "async" : "blocking", mpiWaitTime, deserializeTime);
+}
 
 uint64_t
 RankSyncParallelSkip::getDataSize() const
@@ -226,15 +270,77 @@ RankSyncParallelSkip::exchange_slave(int thread)
     slaveExchangeDoneBarrier.wait();
 }
 
+void
+RankSyncParallelSkip::postReceives()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    for ( size_t i = 0; i < recv_pairs.size(); ++i ) {
+        comm_recv_pair* recv = recv_pairs[i];
+        int             tag  = 2 * recv->local_thread;
+        MPI_Irecv(recv->rbuf, recv->local_size, MPI_BYTE, recv->remote_rank, tag, MPI_COMM_WORLD, &recv_reqs[i]);
+    }
+    recvs_posted = true;
+#endif
+}
+
+int
+RankSyncParallelSkip::testReceives()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    int count;
+    MPI_Testsome(recv_reqs.size(), recv_reqs.data(), &count, recv_indices.data(), MPI_STATUSES_IGNORE);
+    if ( count == MPI_UNDEFINED ) return 0;
+
+    for ( int j = 0; j < count; ++j ) {
+        comm_recv_pair* recv = recv_pairs[recv_indices[j]];
+
+        SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(recv->rbuf);
+        unsigned int       size = hdr->buffer_size;
+        int                mode = hdr->mode;
+
+        if ( mode == 1 ) {
+            // May need to resize the buffer
+            if ( size > recv->local_size ) {
+                delete[] recv->rbuf;
+                recv->rbuf       = new char[size];
+                recv->local_size = size;
+            }
+            auto waitStart = SST::Core::Profile::now();
+            MPI_Recv(
+                recv->rbuf, recv->local_size, MPI_BYTE, recv->remote_rank, 2 * recv->local_thread + 1, MPI_COMM_WORLD,
+                MPI_STATUS_IGNORE);
+            mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+        }
+
+        deserialize_queue.try_insert(recv);
+    }
+    return count;
+#else
+    return 0;
+#endif
+}
+
+void
+RankSyncParallelSkip::waitSends()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( send_req_count == 0 ) return;
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Waitall(send_req_count, send_reqs.data(), MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    send_req_count = 0;
+#endif
+}
+
 void
 RankSyncParallelSkip::exchange_master(int UNUSED(thread))
 {
 #ifdef SST_CONFIG_HAVE_MPI
 
-    // Maximum number of outstanding requests is 3 times the number
-    // of ranks I communicate with (1 recv, 2 sends per rank)
-    MPI_Request sreqs[2 * comm_send_map.size()];
-    int         sreq_count = 0;
+    // In async mode the sends from the last exchange may still be
+    // outstanding and they use the same buffers we are about to
+    // serialize into
+    waitSends();
 
     // First thing to do is fill the serialize_queue.
     for ( auto i = comm_send_map.begin(); i != comm_send_map.end(); ++i ) {
@@ -245,24 +351,23 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
 
     serializeReadyBarrier.wait(); /* Wait for / release slaves to serialize */
 
-    for ( auto i = comm_recv_map.begin(); i != comm_recv_map.end(); ++i ) {
-        // Post all the receives
-        int tag             = 2 * i->second.local_thread;
-        i->second.recv_done = false;
-        MPI_Irecv(
-            i->second.rbuf, i->second.local_size, MPI_BYTE, i->second.remote_rank, tag, MPI_COMM_WORLD, &i->second.req);
-    }
+    // In async mode the receives were posted at the end of the last
+    // exchange
+    if ( !recvs_posted ) postReceives();
 
-    // Do all the sends, but if there are no sends to do, then help
-    // with serialization
-    int             my_send_count = send_count;
+    // Post each send as soon as its buffer is serialized.  When there
+    // is nothing to send, check for receives and help with
+    // serialization and deserialization.
+    int             my_send_count       = send_count;
+    int             receives_to_process = comm_recv_map.size();
     comm_send_pair* send;
+    comm_recv_pair* recv;
 
 #if SST_EVENT_PROFILING
     Simulation_impl* sim = Simulation_impl::getSimulation();
 #endif
 
-    while ( my_send_count != 0 ) {
+    while ( my_send_count != 0 || receives_to_process != 0 ) {
         if ( send_queue.try_remove(send) ) {
             my_send_count--;
 
@@ -276,7 +381,7 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
                 hdr->mode = 1;
                 MPI_Isend(
                     send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, send->to_rank.rank /*dest*/, tag, MPI_COMM_WORLD,
-                    &sreqs[sreq_count++]);
+                    &send_reqs[send_req_count++]);
                 send->remote_size = hdr->buffer_size;
                 tag               = 2 * send->to_rank.thread + 1;
             }
@@ -285,7 +390,7 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
             }
             MPI_Isend(
                 send_buffer, hdr->buffer_size, MPI_BYTE, send->to_rank.rank /*dest*/, tag, MPI_COMM_WORLD,
-                &sreqs[sreq_count++]);
+                &send_reqs[send_req_count++]);
         }
         else if ( serialize_queue.try_remove(send) ) {
             // Serialize the events
@@ -297,71 +402,80 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
             send_queue.try_insert(send);
         }
         else {
-            sst_pause();
-        }
-    }
-
-    // Do all the receives as they arrive
-    int receives_to_process = comm_recv_map.size();
-    while ( receives_to_process != 0 ) {
-        for ( auto i = comm_recv_map.begin(); i != comm_recv_map.end(); ++i ) {
-            if ( !i->second.recv_done ) {
-                int flag;
-                MPI_Test(&i->second.req, &flag, MPI_STATUS_IGNORE);
-                if ( flag ) {
-                    receives_to_process--;
-                    i->second.recv_done = true;
-
-                    // Get the buffer and deserialize all the events
-                    char* buffer = i->second.rbuf;
-
-                    SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(buffer);
-                    unsigned int       size = hdr->buffer_size;
-                    int                mode = hdr->mode;
-
-                    if ( mode == 1 ) {
-                        // May need to resize the buffer
-                        if ( size > i->second.local_size ) {
-                            delete[] i->second.rbuf;
-                            i->second.rbuf       = new char[size];
-                            i->second.local_size = size;
-                        }
-                        MPI_Recv(
-                            i->second.rbuf, i->second.local_size, MPI_BYTE, i->second.remote_rank,
-                            2 * i->second.local_thread + 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-                        buffer = i->second.rbuf;
-                    }
-
-                    deserialize_queue.try_insert(&(i->second));
-                }
+            int found = receives_to_process == 0 ? 0 : testReceives();
+            receives_to_process -= found;
+            if ( found != 0 ) continue;
+
+            if ( deserialize_queue.try_remove(recv) ) {
+                remaining_deser--;
+                deserializeMessage(recv);
+                link_send_queue[recv->local_thread].insert(recv);
+            }
+            else {
+                auto waitStart = SST::Core::Profile::now();
+                sst_pause();
+                mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
             }
         }
     }
+    recvs_posted = false;
 
-    // For now simply call exchange_slave() to deliver events
+    // Deliver the events.  This will also finish any deserialization
+    // that is left.
     exchange_slave(0); /* Barriers at end */
 
-    // Clear the SyncQueues used to send the data after all the sends have completed
-    // waitStart = SST::Core::Profile::now();
-    MPI_Waitall(sreq_count, sreqs, MPI_STATUSES_IGNORE);
-    // mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
-
+    // The SyncQueues can be cleared now since the data has already
+    // been serialized into their buffers.  The buffers can't be
+    // reused until the sends complete.
     for ( auto i = comm_send_map.begin(); i != comm_send_map.end(); ++i ) {
         i->second.squeue->clear();
     }
 
-    // Check to see when the next event is scheduled, then do an
-    // all_reduce with min operator and set next sync time to be
-    // min + max_period.
+    SimTime_t period = max_period->getFactor();
+
+    if ( !async ) {
+        waitSends();
+
+        // Check to see when the next event is scheduled, then do an
+        // all_reduce with min operator and set next sync time to be
+        // min + max_period.
+        SimTime_t input = Simulation_impl::getLocalMinimumNextActivityTime();
+        SimTime_t min_time;
 
-    // Need to get the local minimum, then do a global minimum
-    // SimTime_t input = Simulation_impl::getSimulation()->getNextActivityTime();
-    SimTime_t input = Simulation_impl::getLocalMinimumNextActivityTime();
-    SimTime_t min_time;
-    MPI_Allreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+        auto waitStart = SST::Core::Profile::now();
+        MPI_Allreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+        mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+        myNextSyncTime = min_time + period;
+        return;
+    }
+
+    // All the receive buffers are free again, so post the receives
+    // for the next exchange.
+    postReceives();
+
+    // Without a current global minimum, the next sync can only be
+    // one period away.  The reduction started at the last sync is
+    // still valid if nothing was scheduled before now: no rank could
+    // have executed or sent anything since, so we can skip ahead just
+    // like the blocking version would have done last time.
+    SimTime_t current = Simulation_impl::getSimulation()->getCurrentSimCycle();
+    SimTime_t next    = current + period;
+    if ( min_time_pending ) {
+        auto waitStart = SST::Core::Profile::now();
+        MPI_Wait(&min_time_req, MPI_STATUS_IGNORE);
+        mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+        min_time_pending = false;
+
+        if ( min_time_result > current ) next = min_time_result + period;
+    }
 
-    myNextSyncTime = min_time + max_period->getFactor();
+    // Start the reduction that will be used at the next sync
+    min_time_input = Simulation_impl::getLocalMinimumNextActivityTime();
+    MPI_Iallreduce(&min_time_input, &min_time_result, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD, &min_time_req);
+    min_time_pending = true;
 
+    myNextSyncTime = next;
 #endif
 }
 
@@ -370,6 +484,7 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
 {
 #ifdef SST_CONFIG_HAVE_MPI
     if ( thread != 0 ) { return; }
+    waitSends();
     // Maximum number of outstanding requests is 3 times the number
     // of ranks I communicate with (1 recv, 2 sends per rank)
     MPI_Request sreqs[2 * comm_send_map.size()];
@@ -379,7 +494,7 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
 
     for ( auto i = comm_recv_map.begin(); i != comm_recv_map.end(); ++i ) {
         // Post all the receives
-        int tag = 2 * i->second.local_thread;
+        int tag = untimedTag(i->second.local_thread);
         MPI_Irecv(
             i->second.rbuf, i->second.local_size, MPI_BYTE, i->second.remote_rank, tag, MPI_COMM_WORLD,
             &rreqs[rreq_count++]);
@@ -393,7 +508,7 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
 
         // Cast to Header so we can get/fill in data
         SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(send_buffer);
-        int                tag = 2 * i->second.to_rank.thread;
+        int                tag = untimedTag(i->second.to_rank.thread);
         // Check to see if remote queue is big enough for data
         if ( i->second.remote_size < hdr->buffer_size ) {
             // not big enough, send message that will tell remote side to get larger buffer
@@ -402,7 +517,7 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
                 send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, i->second.to_rank.rank /*dest*/, tag, MPI_COMM_WORLD,
                 &sreqs[sreq_count++]);
             i->second.remote_size = hdr->buffer_size;
-            tag                   = 2 * i->second.to_rank.thread + 1;
+            tag                   = untimedTag(i->second.to_rank.thread) + 1;
         }
         else {
             hdr->mode = 0;
@@ -432,8 +547,8 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
                 i->second.local_size = size;
             }
             MPI_Recv(
-                i->second.rbuf, i->second.local_size, MPI_BYTE, i->second.remote_rank, 2 * i->second.local_thread + 1,
-                MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+                i->second.rbuf, i->second.local_size, MPI_BYTE, i->second.remote_rank,
+                untimedTag(i->second.local_thread) + 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
             buffer = i->second.rbuf;
         }
 
@@ -18,6 +18,7 @@
 #include "sst/core/warnmacros.h"
 
 #include <map>
+#include <vector>
 
 #ifdef SST_CONFIG_HAVE_MPI
 DISABLE_WARN_MISSING_OVERRIDE
@@ -30,6 +31,25 @@ namespace SST {
 class SyncQueue;
 class TimeConverter;
 
+/**
+ * RankSync that uses all the threads on the rank to serialize and
+ * deserialize the events exchanged with other ranks.
+ *
+ * In asynchronous mode (--async-rank-sync), the receives for the next
+ * exchange are posted as soon as the current one is delivered, sends
+ * are completed at the start of the next exchange and the reduction of
+ * the next activity time uses MPI_Iallreduce.  The result of the
+ * reduction is used at the following sync, so skipping ahead happens
+ * one sync later than in the blocking mode.
+ *
+ * In both modes, thread 0 polls for completed receives with
+ * MPI_Testsome while it posts the sends, and each buffer is queued
+ * for deserialization as soon as it arrives.  The other threads of the
+ * rank take buffers from that queue, and thread 0 does too when it has
+ * nothing else to do.  There is no separate helper thread: MPI is
+ * started with MPI_Init, so only thread 0 can call MPI and a helper
+ * could not see the receives complete on its own.
+ */
 class RankSyncParallelSkip : public RankSync
 {
 public:
@@ -53,6 +73,9 @@ public:
 
     uint64_t getDataSize() const override;
 
+    /** Print the time spent waiting on MPI and deserializing */
+    void outputProfileData(FILE* fp) override;
+
 private:
     static SimTime_t myNextSyncTime;
 
@@ -60,6 +83,18 @@ private:
     void exchange_master(int thread);
     void exchange_slave(int thread);
 
+    // Post the receives for all the ranks we get data from
+    void postReceives();
+    // Check for completed receives and queue them for
+    // deserialization.  Returns the number of receives found.
+    int  testReceives();
+    // Wait for all the sends from the last exchange to complete
+    void waitSends();
+
+    // Untimed data uses its own tags so that it can never match the
+    // receives posted ahead of time for the next exchange during run
+    int untimedTag(uint32_t thread) const { return 2 * (num_threads + thread); }
+
     struct comm_send_pair
     {
         RankInfo   to_rank;
@@ -75,10 +110,6 @@ private:
         char*                  rbuf; // receive buffer
         std::vector<Activity*> activity_vec;
         uint32_t               local_size;
-        bool                   recv_done;
-#ifdef SST_CONFIG_HAVE_MPI
-        MPI_Request req;
-#endif
     };
 
     typedef std::map<RankInfo, comm_send_pair> comm_send_map_t;
@@ -94,8 +125,28 @@ private:
     double mpiWaitTime;
     double deserializeTime;
 
-    int* recv_count;
-    int  send_count;
+    bool async;
+
+#ifdef SST_CONFIG_HAVE_MPI
+    // Outstanding requests.  recv_pairs holds the comm_recv_pair that
+    // goes with each entry in recv_reqs.
+    std::vector<MPI_Request>     recv_reqs;
+    std::vector<comm_recv_pair*> recv_pairs;
+    std::vector<int>             recv_indices;
+    std::vector<MPI_Request>     send_reqs;
+    int                          send_req_count;
+    bool                         recvs_posted;
+
+    // Non-blocking reduction of the next activity time
+    MPI_Request min_time_req;
+    SimTime_t   min_time_input;
+    SimTime_t   min_time_result;
+    bool        min_time_pending;
+#endif
+
+    int*     recv_count;
+    int      send_count;
+    uint32_t num_threads;
 
     std::atomic<int32_t>                                    remaining_deser;
     SST::Core::ThreadSafe::BoundedQueue<comm_recv_pair*>    deserialize_queue;
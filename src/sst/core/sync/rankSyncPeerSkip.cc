@@ -0,0 +1,434 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncPeerSkip.h"
+
+#include "sst/core/event.h"
+#include "sst/core/link.h"
+#include "sst/core/profile.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/sync/syncQueue.h"
+#include "sst/core/timeConverter.h"
+#include "sst/core/warnmacros.h"
+
+#include <cinttypes>
+#include <vector>
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#define UNUSED_WO_MPI(x) x
+#else
+#define UNUSED_WO_MPI(x) UNUSED(x)
+#endif
+
+#if SST_EVENT_PROFILING
+#define SST_EVENT_PROFILE_START auto event_profile_start = std::chrono::high_resolution_clock::now();
+
+#define SST_EVENT_PROFILE_STOP                                                                                  \
+    auto event_profile_stop = std::chrono::high_resolution_clock::now();                                        \
+    auto event_profile_count =                                                                                  \
+        std::chrono::duration_cast<std::chrono::nanoseconds>(event_profile_stop - event_profile_start).count(); \
+    sim->incrementSerialCounters(event_profile_count);
+#else
+#define SST_EVENT_PROFILE_START
+#define SST_EVENT_PROFILE_STOP
+#endif
+
+
+namespace SST {
+
+// First multiple of period that is strictly greater than time
+static inline SimTime_t
+nextMultiple(SimTime_t time, SimTime_t period)
+{
+    return (time / period + 1) * period;
+}
+
+// Static Data Members
+SimTime_t RankSyncPeerSkip::myNextSyncTime = 0;
+
+RankSyncPeerSkip::RankSyncPeerSkip(RankInfo num_ranks, TimeConverter* UNUSED(minPartTC)) :
+    RankSync(num_ranks),
+    last_sync_global(false),
+    mpiWaitTime(0.0),
+    deserializeTime(0.0)
+{
+    max_period       = Simulation_impl::getSimulation()->getMinPartTC();
+    myNextSyncTime   = max_period->getFactor();
+    global_period    = max_period->getFactor();
+    next_global_sync = global_period;
+}
+
+RankSyncPeerSkip::~RankSyncPeerSkip()
+{
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        delete i->second.squeue;
+        delete[] i->second.rbuf;
+    }
+    comm_map.clear();
+
+    if ( mpiWaitTime > 0.0 || deserializeTime > 0.0 )
+        Output::getDefaultObject().verbose(
+            CALL_INFO, 1, 0, "RankSyncPeerSkip mpiWait: %lg sec  deserializeWait:  %lg sec\n", mpiWaitTime,
+            deserializeTime);
+}
+
+ActivityQueue*
+RankSyncPeerSkip::registerLink(
+    const RankInfo& to_rank, const RankInfo& UNUSED(from_rank), const std::string& name, Link* link)
+{
+    std::lock_guard<Core::ThreadSafe::Spinlock> slock(lock);
+
+    SyncQueue* queue;
+    if ( comm_map.count(to_rank.rank) == 0 ) {
+        queue = comm_map[to_rank.rank].squeue = new SyncQueue();
+        comm_map[to_rank.rank].rbuf           = new char[4096];
+        comm_map[to_rank.rank].local_size     = 4096;
+        comm_map[to_rank.rank].remote_size    = 4096;
+        comm_map[to_rank.rank].lookahead      = MAX_SIMTIME_T;
+        comm_map[to_rank.rank].exchanges      = 0;
+        comm_map[to_rank.rank].saved          = 0;
+    }
+    else {
+        queue = comm_map[to_rank.rank].squeue;
+    }
+
+    // The link passed in is the sync side of the pair, the latency
+    // for sending to the peer is on the component side
+    SimTime_t latency = getSendLatency(link);
+    if ( latency < comm_map[to_rank.rank].lookahead ) comm_map[to_rank.rank].lookahead = latency;
+
+    link_maps[to_rank.rank][name] = reinterpret_cast<uintptr_t>(link);
+#ifdef __SST_DEBUG_EVENT_TRACKING__
+    link->setSendingComponentInfo("SYNC", "SYNC", "");
+#endif
+    return queue;
+}
+
+void
+RankSyncPeerSkip::finalizeLinkConfigurations()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // We only know the latencies for sending to each peer, so swap
+    // them to get the lookahead in both directions
+    std::vector<SimTime_t>   remote_lookahead(comm_map.size());
+    std::vector<MPI_Request> reqs(2 * comm_map.size());
+    int                      req_count = 0;
+    int                      index     = 0;
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        MPI_Isend(&i->second.lookahead, 1, MPI_UINT64_T, i->first, 3, MPI_COMM_WORLD, &reqs[req_count++]);
+        MPI_Irecv(&remote_lookahead[index++], 1, MPI_UINT64_T, i->first, 3, MPI_COMM_WORLD, &reqs[req_count++]);
+    }
+    MPI_Waitall(req_count, reqs.data(), MPI_STATUSES_IGNORE);
+
+    // The period for each peer is the largest power of two multiple
+    // of the minimum partition latency that fits in the lookahead.
+    // Every period then divides the largest one.
+    SimTime_t base    = max_period->getFactor();
+    SimTime_t largest = base;
+    index             = 0;
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        comm_pair& peer = i->second;
+        if ( remote_lookahead[index] < peer.lookahead ) peer.lookahead = remote_lookahead[index];
+        index++;
+
+        peer.period = base;
+        while ( peer.period <= peer.lookahead / 2 ) {
+            peer.period *= 2;
+        }
+        if ( peer.period > largest ) largest = peer.period;
+    }
+
+    MPI_Allreduce(&largest, &global_period, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
+    next_global_sync = global_period;
+
+    myNextSyncTime = next_global_sync;
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        i->second.next_sync = i->second.period;
+        if ( i->second.next_sync < myNextSyncTime ) myNextSyncTime = i->second.next_sync;
+    }
+#endif
+}
+
+void
+RankSyncPeerSkip::prepareForComplete()
+{}
+
+uint64_t
+RankSyncPeerSkip::getDataSize() const
+{
+    size_t count = 0;
+    for ( comm_map_t::const_iterator it = comm_map.begin(); it != comm_map.end(); ++it ) {
+        count += (it->second.squeue->getDataSize() + it->second.local_size);
+    }
+    return count;
+}
+
+void
+RankSyncPeerSkip::outputProfileData(FILE* fp)
+{
+    fprintf(fp, "RankSyncPeerSkip\n");
+    fprintf(fp, "  Global period = %" PRIu64 "\n", global_period);
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        const comm_pair& peer = i->second;
+        fprintf(
+            fp,
+            "  Rank %d: lookahead = %" PRIu64 ", period = %" PRIu64 ", exchanges = %" PRIu64 ", saved = %" PRIu64 "\n",
+            i->first, peer.lookahead, peer.period, peer.exchanges, peer.saved);
+    }
+}
+
+void
+RankSyncPeerSkip::execute(int thread)
+{
+    if ( thread == 0 ) { exchange(); }
+}
+
+void
+RankSyncPeerSkip::exchange(void)
+{
+#ifdef SST_CONFIG_HAVE_MPI
+
+    // Maximum number of outstanding requests is 3 times the number
+    // of ranks I communicate with (1 recv, 2 sends per rank)
+    MPI_Request sreqs[2 * comm_map.size()];
+    MPI_Request rreqs[comm_map.size()];
+    int         sreq_count = 0;
+    int         rreq_count = 0;
+
+    Simulation_impl* sim           = Simulation_impl::getSimulation();
+    SimTime_t        current_cycle = sim->getCurrentSimCycle();
+
+    // Only exchange with the peers that are due.  The peer computes
+    // the same schedule, so it will be exchanging with us as well.
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        if ( i->second.next_sync != current_cycle ) continue;
+
+        SST_EVENT_PROFILE_START
+
+        // Do all the sends
+        // Get the buffer from the syncQueue
+        char* send_buffer = i->second.squeue->getData();
+
+        SST_EVENT_PROFILE_STOP
+
+        // Cast to Header so we can get/fill in data
+        SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+        int                tag = 1;
+        // Check to see if remote queue is big enough for data
+        if ( i->second.remote_size < hdr->buffer_size ) {
+            // not big enough, send message that will tell remote side to get larger buffer
+            hdr->mode = 1;
+            MPI_Isend(
+                send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
+                &sreqs[sreq_count++]);
+            i->second.remote_size = hdr->buffer_size;
+            tag                   = 2;
+        }
+        else {
+            hdr->mode = 0;
+        }
+        MPI_Isend(
+            send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+
+        // Post all the receives
+        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+    }
+
+    // Wait for all recvs to complete
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Waitall(rreq_count, rreqs, MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    // Reuse the serializer and activity vector for all the receives
+    SST::Core::Serialization::serializer ser;
+    std::vector<Activity*>               activities;
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        if ( i->second.next_sync != current_cycle ) continue;
+
+        // Get the buffer and deserialize all the events
+        char* buffer = i->second.rbuf;
+
+        SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(buffer);
+        unsigned int       size = hdr->buffer_size;
+        int                mode = hdr->mode;
+
+        if ( mode == 1 ) {
+            // May need to resize the buffer
+            if ( size > i->second.local_size ) {
+                delete[] i->second.rbuf;
+                i->second.rbuf       = new char[size];
+                i->second.local_size = size;
+            }
+            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            buffer = i->second.rbuf;
+        }
+
+        auto deserialStart = SST::Core::Profile::now();
+
+        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], size - sizeof(SyncQueue::Header));
+
+        activities.clear();
+        ser& activities;
+
+        deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+
+        for ( unsigned int j = 0; j < activities.size(); j++ ) {
+
+            Event*    ev    = static_cast<Event*>(activities[j]);
+            SimTime_t delay = ev->getDeliveryTime() - current_cycle;
+            getDeliveryLink(ev)->send(delay, ev);
+        }
+
+        activities.clear();
+    }
+
+    // Clear the SyncQueues used to send the data after all the sends have completed
+    waitStart = SST::Core::Profile::now();
+    MPI_Waitall(sreq_count, sreqs, MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        if ( i->second.next_sync != current_cycle ) continue;
+        i->second.squeue->clear();
+        i->second.exchanges++;
+    }
+
+    // Every pair is due at a global sync.  Get the global minimum
+    // next activity time so we can skip past idle time.  Windows stay
+    // aligned to multiples of the periods, so both sides of each pair
+    // still agree on when to exchange.
+    last_sync_global  = current_cycle == next_global_sync;
+    SimTime_t skip_to = current_cycle;
+    if ( last_sync_global ) {
+        SimTime_t input = Simulation_impl::getLocalMinimumNextActivityTime();
+        SimTime_t min_time;
+
+        waitStart = SST::Core::Profile::now();
+        MPI_Allreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+        mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+        // Nothing left anywhere; keep syncing so the Exit can end the
+        // simulation
+        if ( min_time != MAX_SIMTIME_T && min_time > current_cycle ) skip_to = min_time;
+        next_global_sync = nextMultiple(skip_to, global_period);
+    }
+
+    myNextSyncTime = next_global_sync;
+    SimTime_t base = max_period->getFactor();
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        if ( i->second.next_sync == current_cycle ) {
+            i->second.next_sync = nextMultiple(skip_to, i->second.period);
+            i->second.saved += (i->second.next_sync - current_cycle) / base - 1;
+        }
+        if ( i->second.next_sync < myNextSyncTime ) myNextSyncTime = i->second.next_sync;
+    }
+#endif
+}
+
+void
+RankSyncPeerSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atomic<int>& UNUSED_WO_MPI(msg_count))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( thread != 0 ) { return; }
+    // Maximum number of outstanding requests is 3 times the number of
+    // ranks I communicate with (1 recv, 2 sends per rank)
+    MPI_Request sreqs[2 * comm_map.size()];
+    MPI_Request rreqs[comm_map.size()];
+    int         rreq_count = 0;
+    int         sreq_count = 0;
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+
+        // Do all the sends
+        // Get the buffer from the syncQueue
+        char*              send_buffer = i->second.squeue->getData();
+        // Cast to Header so we can get/fill in data
+        SyncQueue::Header* hdr         = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+        int                tag         = 1;
+        // Check to see if remote queue is big enough for data
+        if ( i->second.remote_size < hdr->buffer_size ) {
+            // not big enough, send message that will tell remote side to get larger buffer
+            hdr->mode = 1;
+            MPI_Isend(
+                send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
+                &sreqs[sreq_count++]);
+            i->second.remote_size = hdr->buffer_size;
+            tag                   = 2;
+        }
+        else {
+            hdr->mode = 0;
+        }
+        MPI_Isend(
+            send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+
+        // Post all the receives
+        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+    }
+
+    // Wait for all recvs to complete
+    MPI_Waitall(rreq_count, rreqs, MPI_STATUSES_IGNORE);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+
+        // Get the buffer and deserialize all the events
+        char* buffer = i->second.rbuf;
+
+        SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(buffer);
+        unsigned int       size = hdr->buffer_size;
+        int                mode = hdr->mode;
+
+        if ( mode == 1 ) {
+            // May need to resize the buffer
+            if ( size > i->second.local_size ) {
+                delete[] i->second.rbuf;
+                i->second.rbuf       = new char[size];
+                i->second.local_size = size;
+            }
+            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            buffer = i->second.rbuf;
+        }
+
+        SST::Core::Serialization::serializer ser;
+        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], size - sizeof(SyncQueue::Header));
+
+        std::vector<Activity*> activities;
+        ser&                   activities;
+        for ( unsigned int j = 0; j < activities.size(); j++ ) {
+
+            Event* ev = static_cast<Event*>(activities[j]);
+            sendUntimedData_sync(getDeliveryLink(ev), ev);
+        }
+    }
+
+    // Clear the SyncQueues used to send the data after all the sends have completed
+    MPI_Waitall(sreq_count, sreqs, MPI_STATUSES_IGNORE);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        i->second.squeue->clear();
+    }
+
+    // Do an allreduce to see if there were any messages sent
+    int input = msg_count;
+
+    int count;
+    MPI_Allreduce(&input, &count, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    msg_count = count;
+#endif
+}
+
+} // namespace SST
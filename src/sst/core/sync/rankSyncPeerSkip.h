@@ -0,0 +1,110 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCPEERSKIP_H
+#define SST_CORE_SYNC_RANKSYNCPEERSKIP_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/syncManager.h"
+#include "sst/core/threadsafe.h"
+
+#include <map>
+
+namespace SST {
+
+class SyncQueue;
+class TimeConverter;
+
+/**
+ * RankSync that exchanges with each peer rank using a lookahead
+ * computed from the links between the two ranks instead of the
+ * global minimum partition latency.
+ *
+ * The period for each pair of ranks is the largest power of two
+ * multiple of the minimum partition latency that is no larger than
+ * the minimum latency of the links between the pair.  This keeps all
+ * the exchange times aligned, so every pair exchanges at multiples of
+ * the largest period.  Only those syncs are global: the next activity
+ * time is reduced to skip idle time and the Exit is checked.  All
+ * other syncs only involve the peers that are due.
+ *
+ * Only used with one thread per rank.
+ */
+class RankSyncPeerSkip : public RankSync
+{
+public:
+    /** Create a new Sync object which fires with a specified period */
+    RankSyncPeerSkip(RankInfo num_ranks, TimeConverter* minPartTC);
+    virtual ~RankSyncPeerSkip();
+
+    /** Register a Link which this Sync Object is responsible for */
+    ActivityQueue*
+         registerLink(const RankInfo& to_rank, const RankInfo& from_rank, const std::string& name, Link* link) override;
+    void execute(int thread) override;
+
+    /** Cause an exchange of Untimed Data to occur */
+    void exchangeLinkUntimedData(int thread, std::atomic<int>& msg_count) override;
+    /** Finish link configuration.  Also computes the lookahead for
+     * each peer rank */
+    void finalizeLinkConfigurations() override;
+    /** Prepare for the complete() stage */
+    void prepareForComplete() override;
+
+    SimTime_t getNextSyncTime() override { return myNextSyncTime; }
+
+    bool isGlobalSync() const override { return last_sync_global; }
+
+    uint64_t getDataSize() const override;
+
+    /** Print the lookahead and number of exchanges done and saved
+     * for each peer rank */
+    void outputProfileData(FILE* fp) override;
+
+private:
+    static SimTime_t myNextSyncTime;
+
+    // Function that actually does the exchange during run
+    void exchange();
+
+    struct comm_pair
+    {
+        SyncQueue* squeue; // SyncQueue
+        char*      rbuf;   // receive buffer
+        uint32_t   local_size;
+        uint32_t   remote_size;
+
+        SimTime_t lookahead; // minimum latency of the links to the peer
+        SimTime_t period;    // time between exchanges with the peer
+        SimTime_t next_sync;
+        uint64_t  exchanges;
+        uint64_t  saved; // exchanges skipped compared to syncing every minimum partition latency
+    };
+
+    typedef std::map<int, comm_pair>         comm_map_t;
+    typedef std::map<std::string, uintptr_t> link_map_t;
+
+    comm_map_t comm_map;
+    link_map_t link_map;
+
+    // Period and next time of the syncs that include all the ranks
+    SimTime_t global_period;
+    SimTime_t next_global_sync;
+    bool      last_sync_global;
+
+    double mpiWaitTime;
+    double deserializeTime;
+
+    Core::ThreadSafe::Spinlock lock;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCPEERSKIP_H
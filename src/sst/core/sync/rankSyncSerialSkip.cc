@@ -64,6 +64,7 @@ RankSyncSerialSkip::~RankSyncSerialSkip()
 {
     for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
         delete i->second.squeue;
+        delete[] i->second.rbuf;
     }
     comm_map.clear();
 
@@ -121,6 +122,103 @@ RankSyncSerialSkip::execute(int thread)
     if ( thread == 0 ) { exchange(); }
 }
 
+void
+RankSyncSerialSkip::deliverData(
+    char* buffer, SimTime_t current_cycle, SST::Core::Serialization::serializer& ser,
+    std::vector<Activity*>& activities)
+{
+    SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(buffer);
+    unsigned int       size = hdr->buffer_size;
+
+    auto deserialStart = SST::Core::Profile::now();
+
+    ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], size - sizeof(SyncQueue::Header));
+
+    activities.clear();
+    ser& activities;
+
+    deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+
+    for ( unsigned int j = 0; j < activities.size(); j++ ) {
+
+        Event*    ev    = static_cast<Event*>(activities[j]);
+        SimTime_t delay = ev->getDeliveryTime() - current_cycle;
+        getDeliveryLink(ev)->send(delay, ev);
+    }
+
+    activities.clear();
+}
+
+#ifdef SST_CONFIG_HAVE_MPI
+void
+RankSyncSerialSkip::sendData(int rank, comm_pair& peer, char* send_buffer, MPI_Request* sreqs, int& sreq_count)
+{
+    // Cast to Header so we can get/fill in data
+    SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+    int                tag = 1;
+    // Check to see if remote queue is big enough for data
+    if ( peer.remote_size < hdr->buffer_size ) {
+        // not big enough, send message that will tell remote side to get larger buffer
+        hdr->mode = 1;
+        MPI_Isend(
+            send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, rank /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+        peer.remote_size = hdr->buffer_size;
+        tag              = 2;
+    }
+    else {
+        hdr->mode = 0;
+    }
+    MPI_Isend(send_buffer, hdr->buffer_size, MPI_BYTE, rank /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+}
+
+char*
+RankSyncSerialSkip::receiveData(int rank, comm_pair& peer)
+{
+    SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(peer.rbuf);
+    unsigned int       size = hdr->buffer_size;
+    int                mode = hdr->mode;
+
+    if ( mode == 1 ) {
+        // May need to resize the buffer
+        if ( size > peer.local_size ) {
+            delete[] peer.rbuf;
+            peer.rbuf       = new char[size];
+            peer.local_size = size;
+        }
+        MPI_Recv(peer.rbuf, peer.local_size, MPI_BYTE, rank, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    }
+    return peer.rbuf;
+}
+
+void
+RankSyncSerialSkip::finishExchange(MPI_Request* sreqs, int sreq_count)
+{
+    // Clear the SyncQueues used to send the data after all the sends have completed
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Waitall(sreq_count, sreqs, MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        i->second.squeue->clear();
+    }
+
+    // If we have an Exit object, fire it to see if we need end simulation
+    // if ( exit != nullptr ) exit->check();
+
+    // Check to see when the next event is scheduled, then do an
+    // all_reduce with min operator and set next sync time to be
+    // min + max_period.
+
+    // Need to get the local minimum, then do a global minimum
+    // SimTime_t input = Simulation_impl::getSimulation()->getNextActivityTime();
+    SimTime_t input = Simulation_impl::getLocalMinimumNextActivityTime();
+    SimTime_t min_time;
+    MPI_Allreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+
+    myNextSyncTime = min_time + max_period->getFactor();
+}
+#endif
+
 void
 RankSyncSerialSkip::exchange(void)
 {
@@ -145,25 +243,7 @@ RankSyncSerialSkip::exchange(void)
 
         SST_EVENT_PROFILE_STOP
 
-        // Cast to Header so we can get/fill in data
-        SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(send_buffer);
-        // Simulation_impl::getSimulation()->getSimulationOutput().output("Data size = %d\n", hdr->buffer_size);
-        int                tag = 1;
-        // Check to see if remote queue is big enough for data
-        if ( i->second.remote_size < hdr->buffer_size ) {
-            // not big enough, send message that will tell remote side to get larger buffer
-            hdr->mode = 1;
-            MPI_Isend(
-                send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
-                &sreqs[sreq_count++]);
-            i->second.remote_size = hdr->buffer_size;
-            tag                   = 2;
-        }
-        else {
-            hdr->mode = 0;
-        }
-        MPI_Isend(
-            send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+        sendData(i->first, i->second, send_buffer, sreqs, sreq_count);
 
         // Post all the receives
         MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
@@ -176,69 +256,16 @@ RankSyncSerialSkip::exchange(void)
     MPI_Waitall(rreq_count, rreqs, MPI_STATUSES_IGNORE);
     mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
 
-    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
-        // Get the buffer and deserialize all the events
-        char* buffer = i->second.rbuf;
-
-        SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(buffer);
-        unsigned int       size = hdr->buffer_size;
-        int                mode = hdr->mode;
-
-        if ( mode == 1 ) {
-            // May need to resize the buffer
-            if ( size > i->second.local_size ) {
-                delete[] i->second.rbuf;
-                i->second.rbuf       = new char[size];
-                i->second.local_size = size;
-            }
-            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-            buffer = i->second.rbuf;
-        }
-
-        auto deserialStart = SST::Core::Profile::now();
-
-        SST::Core::Serialization::serializer ser;
-        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], size - sizeof(SyncQueue::Header));
-
-        std::vector<Activity*> activities;
-        activities.clear();
-        ser& activities;
-
-        deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
-
-        for ( unsigned int j = 0; j < activities.size(); j++ ) {
-
-            Event*    ev    = static_cast<Event*>(activities[j]);
-            SimTime_t delay = ev->getDeliveryTime() - current_cycle;
-            getDeliveryLink(ev)->send(delay, ev);
-        }
-
-        activities.clear();
-    }
-
-    // Clear the SyncQueues used to send the data after all the sends have completed
-    waitStart = SST::Core::Profile::now();
-    MPI_Waitall(sreq_count, sreqs, MPI_STATUSES_IGNORE);
-    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    // Reuse the serializer and activity vector for all the receives
+    SST::Core::Serialization::serializer ser;
+    std::vector<Activity*>               activities;
 
     for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
-        i->second.squeue->clear();
+        // Get the buffer and deserialize all the events
+        deliverData(receiveData(i->first, i->second), current_cycle, ser, activities);
     }
 
-    // If we have an Exit object, fire it to see if we need end simulation
-    // if ( exit != nullptr ) exit->check();
-
-    // Check to see when the next event is scheduled, then do an
-    // all_reduce with min operator and set next sync time to be
-    // min + max_period.
-
-    // Need to get the local minimum, then do a global minimum
-    // SimTime_t input = Simulation_impl::getSimulation()->getNextActivityTime();
-    SimTime_t input = Simulation_impl::getLocalMinimumNextActivityTime();
-    SimTime_t min_time;
-    MPI_Allreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
-
-    myNextSyncTime = min_time + max_period->getFactor();
+    finishExchange(sreqs, sreq_count);
 #endif
 }
 
@@ -258,25 +285,8 @@ RankSyncSerialSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atom
 
         // Do all the sends
         // Get the buffer from the syncQueue
-        char*              send_buffer = i->second.squeue->getData();
-        // Cast to Header so we can get/fill in data
-        SyncQueue::Header* hdr         = reinterpret_cast<SyncQueue::Header*>(send_buffer);
-        int                tag         = 1;
-        // Check to see if remote queue is big enough for data
-        if ( i->second.remote_size < hdr->buffer_size ) {
-            // not big enough, send message that will tell remote side to get larger buffer
-            hdr->mode = 1;
-            MPI_Isend(
-                send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
-                &sreqs[sreq_count++]);
-            i->second.remote_size = hdr->buffer_size;
-            tag                   = 2;
-        }
-        else {
-            hdr->mode = 0;
-        }
-        MPI_Isend(
-            send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+        char* send_buffer = i->second.squeue->getData();
+        sendData(i->first, i->second, send_buffer, sreqs, sreq_count);
 
         // Post all the receives
         MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
@@ -288,22 +298,9 @@ RankSyncSerialSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atom
     for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
 
         // Get the buffer and deserialize all the events
-        char* buffer = i->second.rbuf;
-
-        SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(buffer);
-        unsigned int       size = hdr->buffer_size;
-        int                mode = hdr->mode;
-
-        if ( mode == 1 ) {
-            // May need to resize the buffer
-            if ( size > i->second.local_size ) {
-                delete[] i->second.rbuf;
-                i->second.rbuf       = new char[size];
-                i->second.local_size = size;
-            }
-            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-            buffer = i->second.rbuf;
-        }
+        char*              buffer = receiveData(i->first, i->second);
+        SyncQueue::Header* hdr    = reinterpret_cast<SyncQueue::Header*>(buffer);
+        unsigned int       size   = hdr->buffer_size;
 
         SST::Core::Serialization::serializer ser;
         ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], size - sizeof(SyncQueue::Header));
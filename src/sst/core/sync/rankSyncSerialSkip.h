@@ -15,11 +15,25 @@
 #include "sst/core/sst_types.h"
 #include "sst/core/sync/syncManager.h"
 #include "sst/core/threadsafe.h"
+#include "sst/core/warnmacros.h"
 
 #include <map>
+#include <vector>
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
 
 namespace SST {
 
+namespace Core {
+namespace Serialization {
+class serializer;
+} // namespace Serialization
+} // namespace Core
+
 class SyncQueue;
 class TimeConverter;
 
@@ -46,11 +60,11 @@ public:
 
     uint64_t getDataSize() const override;
 
-private:
+protected:
     static SimTime_t myNextSyncTime;
 
     // Function that actually does the exchange during run
-    void exchange();
+    virtual void exchange();
 
     struct comm_pair
     {
@@ -71,6 +85,26 @@ private:
     double deserializeTime;
 
     Core::ThreadSafe::Spinlock lock;
+
+    // Deserialize the events in buffer and send them on to their
+    // links.  ser and activities are reused across calls.
+    void deliverData(
+        char* buffer, SimTime_t current_cycle, Core::Serialization::serializer& ser,
+        std::vector<Activity*>& activities);
+
+#ifdef SST_CONFIG_HAVE_MPI
+    // Send the data from a SyncQueue to rank.  If the remote receive
+    // buffer is too small, a header telling it to grow the buffer is
+    // sent first.  Adds the requests to sreqs.
+    void sendData(int rank, comm_pair& peer, char* send_buffer, MPI_Request* sreqs, int& sreq_count);
+    // Returns the data received from rank.  If the sender said the
+    // receive buffer was too small, the buffer is grown and the data
+    // is received into it first.
+    char* receiveData(int rank, comm_pair& peer);
+    // Wait for the sends to complete, clear the SyncQueues and find
+    // the next sync time
+    void finishExchange(MPI_Request* sreqs, int sreq_count);
+#endif
 };
 
 } // namespace SST
@@ -0,0 +1,327 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncSharedMemSkip.h"
+
+#include "sst/core/event.h"
+#include "sst/core/exit.h"
+#include "sst/core/interprocess/shmchild.h"
+#include "sst/core/interprocess/shmparent.h"
+#include "sst/core/profile.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/sync/syncQueue.h"
+#include "sst/core/timeConverter.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+#if SST_EVENT_PROFILING
+#define SST_EVENT_PROFILE_START auto event_profile_start = std::chrono::high_resolution_clock::now();
+
+#define SST_EVENT_PROFILE_STOP                                                                                  \
+    auto event_profile_stop = std::chrono::high_resolution_clock::now();                                        \
+    auto event_profile_count =                                                                                  \
+        std::chrono::duration_cast<std::chrono::nanoseconds>(event_profile_stop - event_profile_start).count(); \
+    sim->incrementSerialCounters(event_profile_count);
+#else
+#define SST_EVENT_PROFILE_START
+#define SST_EVENT_PROFILE_STOP
+#endif
+
+
+namespace SST {
+
+using Core::Interprocess::SHMChild;
+using Core::Interprocess::SHMParent;
+
+// Number of chunks in each of the shared memory circular buffers
+static constexpr size_t shm_buffer_entries = 64;
+
+// Time since start, used for the per peer latencies
+static inline uint64_t
+elapsedNanoseconds(const std::chrono::steady_clock::time_point& start)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+RankSyncSharedMemSkip::RankSyncSharedMemSkip(RankInfo num_ranks, TimeConverter* minPartTC) :
+    RankSyncSerialSkip(num_ranks, minPartTC),
+    shmWaitTime(0.0)
+{}
+
+RankSyncSharedMemSkip::~RankSyncSharedMemSkip()
+{
+    for ( peer_map_t::iterator i = peer_map.begin(); i != peer_map.end(); ++i ) {
+        delete i->second.shm_parent;
+        delete i->second.shm_child;
+    }
+    peer_map.clear();
+
+    if ( mpiWaitTime > 0.0 || shmWaitTime > 0.0 || deserializeTime > 0.0 )
+        Output::getDefaultObject().verbose(
+            CALL_INFO, 1, 0, "RankSyncSharedMemSkip mpiWait: %lg sec  shmWait: %lg sec  deserializeWait:  %lg sec\n",
+            mpiWaitTime, shmWaitTime, deserializeTime);
+    // Already reported, don't report them again as RankSyncSerialSkip
+    mpiWaitTime     = 0.0;
+    deserializeTime = 0.0;
+}
+
+void
+RankSyncSharedMemSkip::finalizeLinkConfigurations()
+{
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        peer_state& peer = peer_map[i->first];
+        peer.tunnel      = nullptr;
+        peer.shm_parent  = nullptr;
+        peer.shm_child   = nullptr;
+        peer.send_index  = 0;
+        peer.recv_index  = 0;
+        peer.sbuf        = nullptr;
+        peer.send_size   = 0;
+        peer.send_offset = 0;
+        peer.recv_size   = 0;
+        peer.recv_offset = 0;
+
+        peer.bytes_sent = 0;
+        peer.bytes_recv = 0;
+        peer.exchanges  = 0;
+        peer.latency    = 0;
+    }
+
+#ifdef SST_CONFIG_HAVE_MPI
+    // Find the ranks that share this node
+    int my_rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, my_rank, MPI_INFO_NULL, &node_comm);
+    int node_size;
+    MPI_Comm_size(node_comm, &node_size);
+    std::vector<int> node_ranks(node_size);
+    MPI_Allgather(&my_rank, 1, MPI_INT, node_ranks.data(), 1, MPI_INT, node_comm);
+    MPI_Comm_free(&node_comm);
+
+    // The lower numbered rank of each pair creates the tunnel and
+    // sends the name of the region to the higher numbered rank.
+    // Buffer 0 carries data from the lower rank to the higher rank
+    // and buffer 1 carries data the other way.  The comm_map is
+    // walked in rank order, so the blocking receives can't deadlock.
+    const int                region_name_size = 256;
+    std::vector<MPI_Request> sreqs;
+    sreqs.reserve(comm_map.size());
+
+    for ( peer_map_t::iterator i = peer_map.begin(); i != peer_map.end(); ++i ) {
+        if ( std::find(node_ranks.begin(), node_ranks.end(), i->first) == node_ranks.end() ) continue;
+
+        peer_state& peer = i->second;
+        if ( my_rank < i->first ) {
+            peer.shm_parent = new SHMParent<tunnel_t>(my_rank, 2, shm_buffer_entries);
+            peer.tunnel     = peer.shm_parent->getTunnel();
+            peer.send_index = 0;
+            peer.recv_index = 1;
+
+            const std::string& name = peer.shm_parent->getRegionName();
+            sreqs.emplace_back();
+            MPI_Isend(
+                const_cast<char*>(name.c_str()), name.size() + 1, MPI_CHAR, i->first, 3, MPI_COMM_WORLD,
+                &sreqs.back());
+        }
+        else {
+            char name[region_name_size];
+            MPI_Recv(name, region_name_size, MPI_CHAR, i->first, 3, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            peer.shm_child  = new SHMChild<tunnel_t>(name);
+            peer.tunnel     = peer.shm_child->getTunnel();
+            peer.send_index = 1;
+            peer.recv_index = 0;
+        }
+    }
+
+    MPI_Waitall(sreqs.size(), sreqs.data(), MPI_STATUSES_IGNORE);
+#endif
+}
+
+uint64_t
+RankSyncSharedMemSkip::getDataSize() const
+{
+    size_t count = RankSyncSerialSkip::getDataSize();
+    for ( peer_map_t::const_iterator it = peer_map.begin(); it != peer_map.end(); ++it ) {
+        if ( it->second.tunnel ) count += it->second.tunnel->getTunnelSize();
+    }
+    return count;
+}
+
+void
+RankSyncSharedMemSkip::outputProfileData(FILE* fp)
+{
+    fprintf(fp, "RankSyncSharedMemSkip\n");
+    for ( peer_map_t::iterator i = peer_map.begin(); i != peer_map.end(); ++i ) {
+        const peer_state& peer = i->second;
+        fprintf(
+            fp,
+            "  Rank %d (%s): exchanges = %" PRIu64 ", bytes sent = %" PRIu64 ", bytes received = %" PRIu64
+            ", average latency = %" PRIu64 "ns\n",
+            i->first, peer.tunnel ? "shm" : "mpi", peer.exchanges, peer.bytes_sent, peer.bytes_recv,
+            peer.exchanges == 0 ? 0 : peer.latency / peer.exchanges);
+    }
+}
+
+void
+RankSyncSharedMemSkip::exchangeSharedMem(const std::chrono::steady_clock::time_point& start)
+{
+    Chunk chunk;
+    bool  done = false;
+
+    while ( !done ) {
+        done          = true;
+        bool progress = false;
+
+        comm_map_t::iterator c = comm_map.begin();
+        for ( peer_map_t::iterator i = peer_map.begin(); i != peer_map.end(); ++i, ++c ) {
+            peer_state& peer = i->second;
+            comm_pair&  comm = c->second;
+            if ( !peer.tunnel ) continue;
+
+            // Send as many chunks as will fit in the buffer
+            while ( peer.send_offset < peer.send_size ) {
+                chunk.size = std::min<uint32_t>(Chunk::data_size, peer.send_size - peer.send_offset);
+                memcpy(chunk.data, peer.sbuf + peer.send_offset, chunk.size);
+                if ( !peer.tunnel->writeMessageNB(peer.send_index, chunk) ) break;
+                peer.send_offset += chunk.size;
+                progress = true;
+            }
+
+            // Receive everything that has arrived for this sync.  The
+            // first chunk starts with the header, which holds the
+            // total size of the data.
+            while ( peer.recv_size == 0 || peer.recv_offset < peer.recv_size ) {
+                if ( !peer.tunnel->readMessageNB(peer.recv_index, &chunk) ) break;
+                if ( peer.recv_offset == 0 ) {
+                    uint32_t size = reinterpret_cast<SyncQueue::Header*>(chunk.data)->buffer_size;
+                    if ( size > comm.local_size ) {
+                        delete[] comm.rbuf;
+                        comm.rbuf       = new char[size];
+                        comm.local_size = size;
+                    }
+                    peer.recv_size = size;
+                }
+                memcpy(comm.rbuf + peer.recv_offset, chunk.data, chunk.size);
+                peer.recv_offset += chunk.size;
+                progress = true;
+                if ( peer.recv_offset == peer.recv_size ) peer.latency += elapsedNanoseconds(start);
+            }
+
+            if ( peer.send_offset < peer.send_size || peer.recv_size == 0 || peer.recv_offset < peer.recv_size )
+                done = false;
+        }
+
+        if ( !done && !progress ) std::this_thread::yield();
+    }
+}
+
+void
+RankSyncSharedMemSkip::exchange(void)
+{
+#ifdef SST_CONFIG_HAVE_MPI
+
+    // Maximum number of outstanding requests is 3 times the number
+    // of ranks I communicate with (1 recv, 2 sends per rank)
+    MPI_Request sreqs[2 * comm_map.size()];
+    MPI_Request rreqs[comm_map.size()];
+    peer_state* rpeers[comm_map.size()];
+    int         sreq_count = 0;
+    int         rreq_count = 0;
+
+    Simulation_impl* sim = Simulation_impl::getSimulation();
+
+    auto exchangeStart = std::chrono::steady_clock::now();
+
+    peer_map_t::iterator p = peer_map.begin();
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i, ++p ) {
+
+        SST_EVENT_PROFILE_START
+
+        // Do all the sends
+        // Get the buffer from the syncQueue
+        char* send_buffer = i->second.squeue->getData();
+
+        SST_EVENT_PROFILE_STOP
+
+        SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+        peer_state&        peer = p->second;
+        peer.bytes_sent += hdr->buffer_size;
+        peer.exchanges++;
+
+        if ( peer.tunnel ) {
+            // Ranks on this node are handled by exchangeSharedMem()
+            hdr->mode        = 0;
+            peer.sbuf        = send_buffer;
+            peer.send_size   = hdr->buffer_size;
+            peer.send_offset = 0;
+            peer.recv_size   = 0;
+            peer.recv_offset = 0;
+            continue;
+        }
+
+        sendData(i->first, i->second, send_buffer, sreqs, sreq_count);
+
+        // Post all the receives
+        rpeers[rreq_count] = &peer;
+        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+    }
+
+    SimTime_t current_cycle = sim->getCurrentSimCycle();
+
+    // Move the data to the ranks on this node while the MPI messages
+    // are in flight
+    auto shmStart = SST::Core::Profile::now();
+    exchangeSharedMem(exchangeStart);
+    shmWaitTime += SST::Core::Profile::getElapsed(shmStart);
+
+    // Wait for all recvs to complete
+    auto waitStart = SST::Core::Profile::now();
+    for ( int r = 0; r < rreq_count; ++r ) {
+        int index;
+        MPI_Waitany(rreq_count, rreqs, &index, MPI_STATUS_IGNORE);
+        rpeers[index]->latency += elapsedNanoseconds(exchangeStart);
+    }
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    // Reuse the serializer and activity vector for all the receives
+    SST::Core::Serialization::serializer ser;
+    std::vector<Activity*>               activities;
+
+    p = peer_map.begin();
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i, ++p ) {
+        // Get the buffer and deserialize all the events.  Data from
+        // the tunnels is already complete in the receive buffer.
+        char* buffer = p->second.tunnel ? i->second.rbuf : receiveData(i->first, i->second);
+        p->second.bytes_recv += reinterpret_cast<SyncQueue::Header*>(buffer)->buffer_size;
+        deliverData(buffer, current_cycle, ser, activities);
+    }
+
+    finishExchange(sreqs, sreq_count);
+#endif
+}
+
+} // namespace SST
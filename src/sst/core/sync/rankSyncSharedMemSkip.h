@@ -0,0 +1,116 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCSHAREDMEMSKIP_H
+#define SST_CORE_SYNC_RANKSYNCSHAREDMEMSKIP_H
+
+#include "sst/core/interprocess/tunneldef.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/rankSyncSerialSkip.h"
+
+#include <chrono>
+#include <map>
+
+namespace SST {
+
+namespace Core {
+namespace Interprocess {
+template <typename TunnelType>
+class SHMParent;
+template <typename TunnelType>
+class SHMChild;
+} // namespace Interprocess
+} // namespace Core
+
+class TimeConverter;
+
+/**
+ * RankSync that exchanges events with ranks on the same node through
+ * shared memory and uses MPI for all other ranks.
+ *
+ * Each pair of ranks on the same node shares a tunnel with one
+ * circular buffer in each direction.  The serialized data from the
+ * SyncQueue is split into fixed size chunks and streamed through the
+ * buffer, so the receiver never has to be told to resize before the
+ * data is sent.  Everything else, including the exchange of untimed
+ * data, which always uses MPI, is the same as RankSyncSerialSkip.
+ */
+class RankSyncSharedMemSkip : public RankSyncSerialSkip
+{
+public:
+    /** Create a new Sync object which fires with a specified period */
+    RankSyncSharedMemSkip(RankInfo num_ranks, TimeConverter* minPartTC);
+    virtual ~RankSyncSharedMemSkip();
+
+    /** Finish link configuration.  Also sets up the shared memory
+     * tunnels to the ranks on the same node. */
+    void finalizeLinkConfigurations() override;
+
+    uint64_t getDataSize() const override;
+
+    /** Print the bytes exchanged with and average latency for each
+     * peer rank */
+    void outputProfileData(FILE* fp) override;
+
+    /** Message type used in the shared memory circular buffers */
+    struct Chunk
+    {
+        static constexpr size_t data_size = 4096 - sizeof(uint32_t);
+
+        uint32_t size;
+        char     data[data_size];
+    };
+
+    typedef Core::Interprocess::TunnelDef<int, Chunk> tunnel_t;
+
+private:
+    // Function that actually does the exchange during run
+    void exchange() override;
+
+    // Move chunks through the shared memory tunnels until all the
+    // sends and receives are complete
+    void exchangeSharedMem(const std::chrono::steady_clock::time_point& start);
+
+    // State kept for each rank in comm_map, in addition to its
+    // comm_pair
+    struct peer_state
+    {
+        // Shared memory state, tunnel is nullptr for ranks that are
+        // not on this node
+        tunnel_t*                                tunnel;
+        Core::Interprocess::SHMParent<tunnel_t>* shm_parent;
+        Core::Interprocess::SHMChild<tunnel_t>*  shm_child;
+        size_t                                   send_index;
+        size_t                                   recv_index;
+        char*                                    sbuf;
+        uint32_t                                 send_size;
+        uint32_t                                 send_offset;
+        uint32_t                                 recv_size;
+        uint32_t                                 recv_offset;
+
+        // Per peer profiling data
+        uint64_t bytes_sent;
+        uint64_t bytes_recv;
+        uint64_t exchanges;
+        uint64_t latency; // ns
+    };
+
+    // Has the same keys as comm_map, so the two can be walked together
+    typedef std::map<int, peer_state> peer_map_t;
+
+    peer_map_t peer_map;
+
+    double shmWaitTime;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCSHAREDMEMSKIP_H
@@ -18,7 +18,9 @@
 #include "sst/core/profile/syncProfileTool.h"
 #include "sst/core/simulation_impl.h"
 #include "sst/core/sync/rankSyncParallelSkip.h"
+#include "sst/core/sync/rankSyncPeerSkip.h"
 #include "sst/core/sync/rankSyncSerialSkip.h"
+#include "sst/core/sync/rankSyncSharedMemSkip.h"
 #include "sst/core/sync/threadSyncDirectSkip.h"
 #include "sst/core/sync/threadSyncQueue.h"
 #include "sst/core/sync/threadSyncSimpleSkip.h"
@@ -225,6 +227,24 @@ public:
             x->syncManagerEnd();
     }
 
+    void rankSync(uint64_t rounds_saved)
+    {
+        for ( auto* x : tools )
+            x->rankSync(rounds_saved);
+    }
+
+    void barrierStart()
+    {
+        for ( auto* x : tools )
+            x->barrierStart();
+    }
+
+    void barrierEnd()
+    {
+        for ( auto* x : tools )
+            x->barrierEnd();
+    }
+
     /**
        Adds a profile tool the the list and registers this handler
        with the profile tool
@@ -255,7 +275,13 @@ SyncManager::SyncManager(
             b.resize(num_ranks.thread);
         }
         if ( min_part != MAX_SIMTIME_T ) {
-            if ( num_ranks.thread == 1 ) { rankSync = new RankSyncSerialSkip(num_ranks, minPartTC); }
+            if ( sim->shared_memory_ranks ) { rankSync = new RankSyncSharedMemSkip(num_ranks, minPartTC); }
+            else if ( sim->per_peer_lookahead && num_ranks.thread == 1 ) {
+                rankSync = new RankSyncPeerSkip(num_ranks, minPartTC);
+            }
+            else if ( num_ranks.thread == 1 && !sim->async_rank_sync ) {
+                rankSync = new RankSyncSerialSkip(num_ranks, minPartTC);
+            }
             else {
                 rankSync = new RankSyncParallelSkip(num_ranks, minPartTC);
             }
@@ -333,7 +359,7 @@ SyncManager::execute(void)
         // Need to make sure all threads have reached the sync to
         // guarantee that all events have been sent to the appropriate
         // queues.
-        RankExecBarrier[0].wait();
+        waitRankExecBarrier(0);
 
         // For a rank sync, we will force a thread sync first.  This
         // will ensure that all events sent between threads will be
@@ -343,23 +369,35 @@ SyncManager::execute(void)
 
         // Need to make sure everyone has made it through the mutex
         // and the min time computation is complete
-        RankExecBarrier[1].wait();
+        waitRankExecBarrier(1);
 
         // Now call the actual RankSync
         rankSync->execute(rank.thread);
 
-        RankExecBarrier[2].wait();
+        waitRankExecBarrier(2);
 
         // Now call the threadSync after() call
         threadSync->after();
 
-        RankExecBarrier[3].wait();
+        waitRankExecBarrier(3);
 
-        if ( exit != nullptr && rank.thread == 0 ) exit->check();
+        // Only global syncs can check the Exit
+        if ( rankSync->isGlobalSync() ) {
+            if ( exit != nullptr && rank.thread == 0 ) exit->check();
 
-        RankExecBarrier[4].wait();
+            waitRankExecBarrier(4);
 
-        if ( exit->getGlobalCount() == 0 ) { endSimulation(exit->getEndTime()); }
+            if ( exit->getGlobalCount() == 0 ) { endSimulation(exit->getEndTime()); }
+        }
+
+        if ( profile_tools ) {
+            // Count the minimum partition latency windows that passed
+            // without a rank sync
+            SimTime_t current = sim->getCurrentSimCycle();
+            SimTime_t windows = (current - last_rank_sync) / min_part;
+            profile_tools->rankSync(windows > 1 ? windows - 1 : 0);
+            last_rank_sync = current;
+        }
 
         break;
     case THREAD:
@@ -375,13 +413,26 @@ SyncManager::execute(void)
         break;
     }
     computeNextInsert();
-    RankExecBarrier[5].wait();
+    waitRankExecBarrier(5);
 
     if ( profile_tools ) profile_tools->syncManagerEnd();
 
     SST_SYNC_PROFILE_STOP
 }
 
+void
+SyncManager::waitRankExecBarrier(int index)
+{
+    if ( profile_tools ) {
+        profile_tools->barrierStart();
+        RankExecBarrier[index].wait();
+        profile_tools->barrierEnd();
+    }
+    else {
+        RankExecBarrier[index].wait();
+    }
+}
+
 /** Cause an exchange of Untimed Data to occur */
 void
 SyncManager::exchangeLinkUntimedData(std::atomic<int>& msg_count)
@@ -449,4 +500,11 @@ SyncManager::addProfileTool(Profile::SyncProfileTool* tool)
     profile_tools->addProfileTool(tool);
 }
 
+void
+SyncManager::outputProfileData(FILE* fp)
+{
+    // Only thread 0 executes the RankSync
+    if ( profile_tools && rank.thread == 0 ) rankSync->outputProfileData(fp);
+}
+
 } // namespace SST
@@ -18,6 +18,7 @@
 #include "sst/core/sst_types.h"
 #include "sst/core/threadsafe.h"
 
+#include <cstdio>
 #include <unordered_map>
 #include <vector>
 
@@ -52,11 +53,20 @@ public:
 
     virtual SimTime_t getNextSyncTime() { return nextSyncTime; }
 
+    /** Returns true if the last sync included all the ranks.  The
+     * Exit is only checked on global syncs, since the check is a
+     * collective operation */
+    virtual bool isGlobalSync() const { return true; }
+
     // void setMaxPeriod(TimeConverter* period) {max_period = period;}
     TimeConverter* getMaxPeriod() { return max_period; }
 
     virtual uint64_t getDataSize() const = 0;
 
+    /** Print any profiling data collected by the RankSync.  Called
+     * when sync profiling is enabled */
+    virtual void outputProfileData(FILE* UNUSED(fp)) {}
+
 protected:
     SimTime_t      nextSyncTime;
     TimeConverter* max_period;
@@ -74,6 +84,9 @@ protected:
 
     inline Link* getDeliveryLink(Event* ev) { return ev->getDeliveryLink(); }
 
+    /** Latency for events sent over the link pair that link belongs to */
+    inline SimTime_t getSendLatency(Link* link) { return link->pair_link->latency; }
+
 private:
 };
 
@@ -142,6 +155,9 @@ public:
 
     void addProfileTool(Profile::SyncProfileTool* tool);
 
+    /** Print the RankSync profiling data if sync profiling is enabled */
+    void outputProfileData(FILE* fp);
+
 private:
     enum sync_type_t { RANK, THREAD };
 
@@ -160,11 +176,16 @@ private:
 
     sync_type_t next_sync_type;
     SimTime_t   min_part;
+    SimTime_t   last_rank_sync = 0;
 
     SyncProfileToolList* profile_tools = nullptr;
 
     void computeNextInsert();
 
+    // Wait on one of the RankExecBarriers, reporting the wait to the
+    // profile tools
+    void waitRankExecBarrier(int index);
+
     NotSerializable(SST::SyncManager)
 };
 
@@ -32,29 +32,33 @@ namespace SST {
 using namespace Core::ThreadSafe;
 using namespace Core::Serialization;
 
-SyncQueue::SyncQueue() : ActivityQueue(), buffer(nullptr), buf_size(0) {}
+SyncQueue::SyncQueue() : ActivityQueue(), thread_buffers(Simulation_impl::getSimulation()->getNumRanks().thread) {}
 
 SyncQueue::~SyncQueue() {}
 
 bool
 SyncQueue::empty()
 {
-    std::lock_guard<Spinlock> lock(slock);
-    return activities.empty();
+    for ( auto& x : thread_buffers ) {
+        if ( !x.activities.empty() ) return false;
+    }
+    return true;
 }
 
 int
 SyncQueue::size()
 {
-    std::lock_guard<Spinlock> lock(slock);
-    return activities.size();
+    size_t count = 0;
+    for ( auto& x : thread_buffers ) {
+        count += x.activities.size();
+    }
+    return count;
 }
 
 void
 SyncQueue::insert(Activity* activity)
 {
-    std::lock_guard<Spinlock> lock(slock);
-    activities.push_back(activity);
+    thread_buffers[Simulation_impl::getSimulation()->getRank().thread].activities.push_back(activity);
 }
 
 Activity*
@@ -79,18 +83,39 @@ SyncQueue::front()
 void
 SyncQueue::clear()
 {
-    std::lock_guard<Spinlock> lock(slock);
+    for ( auto& x : thread_buffers ) {
+        x.activities.clear();
+    }
     activities.clear();
 }
 
+uint64_t
+SyncQueue::getDataSize()
+{
+    size_t count = activities.capacity();
+    for ( auto& x : thread_buffers ) {
+        count += x.activities.capacity();
+    }
+    return buffer.capacity() + (count * sizeof(Activity*));
+}
+
 char*
 SyncQueue::getData()
 {
-    std::lock_guard<Spinlock> lock(slock);
+    // Combine the activities from all the threads.  With a single
+    // thread, just swap the vectors.
+    if ( thread_buffers.size() == 1 ) { activities.swap(thread_buffers[0].activities); }
+    else {
+        for ( auto& x : thread_buffers ) {
+            activities.insert(activities.end(), x.activities.begin(), x.activities.end());
+            x.activities.clear();
+        }
+    }
 
+    // Pack directly into the reusable buffer, leaving room for the
+    // header at the front
     serializer ser;
-
-    ser.start_sizing();
+    ser.start_packing(buffer, sizeof(SyncQueue::Header));
 
     ser& activities;
 
@@ -98,17 +123,6 @@ SyncQueue::getData()
 
     SST_EVENT_PROFILE_SIZE(activities.size(), size)
 
-    if ( buf_size < (size + sizeof(SyncQueue::Header)) ) {
-        if ( buffer != nullptr ) { delete[] buffer; }
-
-        buf_size = size + sizeof(SyncQueue::Header);
-        buffer   = new char[buf_size];
-    }
-
-    ser.start_packing(buffer + sizeof(SyncQueue::Header), size);
-
-    ser& activities;
-
     // Delete all the events
     for ( unsigned int i = 0; i < activities.size(); i++ ) {
         delete activities[i];
@@ -116,9 +130,9 @@ SyncQueue::getData()
     activities.clear();
 
     // Set the size field in the header
-    static_cast<SyncQueue::Header*>(static_cast<void*>(buffer))->buffer_size = size + sizeof(SyncQueue::Header);
+    static_cast<SyncQueue::Header*>(static_cast<void*>(buffer.data()))->buffer_size = size + sizeof(SyncQueue::Header);
 
-    return buffer;
+    return buffer.data();
 }
 
 } // namespace SST
@@ -24,7 +24,10 @@ namespace SST {
  *
  * Internal API
  *
- * Activity Queue for use by Sync Objects
+ * Activity Queue for use by Sync Objects.  Each thread inserts into
+ * its own buffer so insert() does not need a lock.  The buffers are
+ * only combined in getData(), which must not be called while other
+ * threads are inserting.
  */
 class SyncQueue : public ActivityQueue
 {
@@ -51,14 +54,21 @@ public:
     /** Accessor method to the internal queue */
     char* getData();
 
-    uint64_t getDataSize() { return buf_size + (activities.capacity() * sizeof(Activity*)); }
+    uint64_t getDataSize();
 
 private:
-    char*                  buffer;
-    size_t                 buf_size;
-    std::vector<Activity*> activities;
+    // Activities sent by a single thread.  Aligned so threads don't
+    // share cache lines.
+    struct CACHE_ALIGNED_T ThreadBuffer
+    {
+        std::vector<Activity*> activities;
+    };
 
-    Core::ThreadSafe::Spinlock slock;
+    // Serialization buffer, reused for every call to getData()
+    std::vector<char>         buffer;
+    // Activities from all the threads, combined for serialization
+    std::vector<Activity*>    activities;
+    std::vector<ThreadBuffer> thread_buffers;
 };
 
 } // namespace SST
@@ -0,0 +1,132 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_ClockBench.h"
+
+using namespace SST;
+using namespace SST::CoreTestClockBench;
+
+coreTestClockBench::coreTestClockBench(ComponentId_t id, Params& params) :
+    Component(id),
+    ticks(0),
+    checksum(0),
+    done(false),
+    stopping(false)
+{
+    std::string clock = params.find<std::string>("clock", "1GHz");
+    num_cycles        = params.find<uint64_t>("num_cycles", 10000);
+    stop_rate         = params.find<uint32_t>("stop_rate", 0);
+    max_sleep         = params.find<uint32_t>("max_sleep", 10);
+    gate              = params.find<bool>("gate", false);
+    uint32_t seed     = params.find<uint32_t>("seed", 1);
+
+    if ( max_sleep == 0 ) max_sleep = 1;
+
+    rng = new SST::RNG::MarsagliaRNG(seed, id + 1);
+
+    // tell the simulator not to end without us
+    registerAsPrimaryComponent();
+    primaryComponentDoNotEndSim();
+
+    if ( seed % 2 == 0 ) {
+        clock_handler = new Clock::Handler<coreTestClockBench>(this, &coreTestClockBench::tick);
+    }
+    else {
+        clock_handler =
+            new Clock::Handler<coreTestClockBench, uint32_t>(this, &coreTestClockBench::tickWithData, seed);
+    }
+    clock_tc = registerClock(clock, clock_handler);
+
+    auto* handler = new Event::Handler<coreTestClockBench>(this, &coreTestClockBench::handleEvent);
+    if ( params.find<bool>("subcomponent_link", false) ) {
+        auto* port = loadAnonymousSubComponent<coreTestClockBenchPortAPI>(
+            "coreTestElement.coreTestClockBenchPort", "port", 0, ComponentInfo::SHARE_NONE, params);
+        self_link = port->configure(clock_tc, handler);
+    }
+    else {
+        self_link = configureSelfLink("self", clock_tc, handler);
+    }
+}
+
+coreTestClockBench::~coreTestClockBench()
+{
+    delete rng;
+}
+
+coreTestClockBench::coreTestClockBench() : Component(-1)
+{
+    // for serialization only
+}
+
+void
+coreTestClockBench::finish()
+{
+    printf("%s: %" PRIu64 " ticks, checksum = %" PRIu64 "\n", getName().c_str(), ticks, checksum);
+}
+
+bool
+coreTestClockBench::tick(Cycle_t cycle)
+{
+    ticks++;
+    checksum = (checksum * 31) + cycle;
+
+    if ( cycle >= num_cycles && !done ) {
+        done = true;
+        primaryComponentOKToEndSim();
+    }
+
+    if ( stopping || stop_rate == 0 || rng->generateNextUInt32() % 100 >= stop_rate ) return false;
+
+    // Stop the clock, either now or from the event handler
+    stopping       = true;
+    uint32_t sleep = rng->generateNextUInt32() % max_sleep;
+    if ( rng->generateNextUInt32() % 2 == 0 ) {
+        self_link->send(sleep, new coreTestClockBenchEvent(true));
+        if ( gate ) {
+            gateClock(clock_tc, clock_handler);
+            return false;
+        }
+        return true;
+    }
+    self_link->send(0, new coreTestClockBenchEvent(false));
+    return false;
+}
+
+bool
+coreTestClockBench::tickWithData(Cycle_t cycle, uint32_t data)
+{
+    checksum ^= data;
+    bool ret = tick(cycle);
+    checksum ^= data;
+    return ret;
+}
+
+void
+coreTestClockBench::handleEvent(Event* ev)
+{
+    coreTestClockBenchEvent* event = static_cast<coreTestClockBenchEvent*>(ev);
+
+    if ( event->wake ) {
+        // The core has already restarted a gated clock
+        stopping = false;
+        if ( !gate ) reregisterClock(clock_tc, clock_handler);
+    }
+    else {
+        if ( gate )
+            gateClock(clock_tc, clock_handler);
+        else
+            unregisterClock(clock_tc, clock_handler);
+        self_link->send(rng->generateNextUInt32() % max_sleep, new coreTestClockBenchEvent(true));
+    }
+    delete event;
+}
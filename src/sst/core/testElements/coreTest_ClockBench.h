@@ -0,0 +1,167 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_CLOCKBENCH_H
+#define SST_CORE_CORETEST_CLOCKBENCH_H
+
+#include "sst/core/component.h"
+#include "sst/core/event.h"
+#include "sst/core/link.h"
+#include "sst/core/rng/marsaglia.h"
+#include "sst/core/subcomponent.h"
+
+namespace SST {
+namespace CoreTestClockBench {
+
+class coreTestClockBenchEvent : public SST::Event
+{
+public:
+    coreTestClockBenchEvent() : SST::Event(), wake(false) {}
+    coreTestClockBenchEvent(bool wake) : SST::Event(), wake(wake) {}
+
+    // Reregister the clock if true, unregister it if false
+    bool wake;
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        Event::serialize_order(ser);
+        ser& wake;
+    }
+
+    ImplementSerializable(SST::CoreTestClockBench::coreTestClockBenchEvent);
+};
+
+/**
+ * Holds the self link of a coreTestClockBench when its
+ * subcomponent_link parameter is set, so the events that wake a gated
+ * clock arrive on a SubComponent's link.
+ */
+class coreTestClockBenchPortAPI : public SST::SubComponent
+{
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT_API(SST::CoreTestClockBench::coreTestClockBenchPortAPI)
+
+    coreTestClockBenchPortAPI(ComponentId_t id) : SubComponent(id) {}
+    virtual ~coreTestClockBenchPortAPI() {}
+
+    /** Configure the self link, delivering to handler */
+    virtual SST::Link* configure(TimeConverter* tc, Event::HandlerBase* handler) = 0;
+};
+
+class coreTestClockBenchPort : public coreTestClockBenchPortAPI
+{
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        coreTestClockBenchPort,
+        "coreTestElement",
+        "coreTestClockBenchPort",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Self link holder for coreTestClockBench",
+        SST::CoreTestClockBench::coreTestClockBenchPortAPI
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+    )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestClockBenchPort(ComponentId_t id, Params& UNUSED(params)) : coreTestClockBenchPortAPI(id) {}
+
+    SST::Link* configure(TimeConverter* tc, Event::HandlerBase* handler) override
+    {
+        return configureSelfLink("self", tc, handler);
+    }
+};
+
+/**
+ * Benchmark for clocks shared by many components.  Each component
+ * does a little work every tick and now and then stops its clock for
+ * a random number of cycles, either by returning true from the
+ * handler or by calling unregisterClock() from an event handler.
+ * With gate set, the clock is stopped with gateClock() instead and
+ * restarted by the core when the wakeup event arrives.  Components
+ * with odd seeds use a handler with user data, so the clock has
+ * handlers of two types.  The number of ticks and a
+ * checksum of the cycles each component saw are printed at the end,
+ * so the output doesn't depend on the order handlers are called in.
+ * With subcomponent_link set, the self link belongs to a SubComponent.
+ */
+class coreTestClockBench : public SST::Component
+{
+public:
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestClockBench,
+        "coreTestElement",
+        "coreTestClockBench",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Clock handler benchmark component",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "clock",      "Clock frequency", "1GHz" },
+        { "num_cycles", "Number of cycles to run before the component allows the simulation to end", "10000" },
+        { "stop_rate",  "Chance (in percent) each tick that the component stops its clock", "0" },
+        { "max_sleep",  "Maximum number of cycles the clock is stopped for", "10" },
+        { "gate",       "Stop the clock with gateClock() and let the core restart it", "false" },
+        { "seed",       "Seed for the random decisions", "1" },
+        { "subcomponent_link", "Put the self link in a SubComponent", "false" }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+    )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+        { "port", "Holds the self link when subcomponent_link is set", "SST::CoreTestClockBench::coreTestClockBenchPortAPI" }
+    )
+
+    coreTestClockBench(SST::ComponentId_t id, SST::Params& params);
+    ~coreTestClockBench();
+
+    void finish() override;
+
+private:
+    coreTestClockBench();                          // for serialization only
+    coreTestClockBench(const coreTestClockBench&); // do not implement
+    void operator=(const coreTestClockBench&);     // do not implement
+
+    bool tick(SST::Cycle_t cycle);
+    bool tickWithData(SST::Cycle_t cycle, uint32_t data);
+    void handleEvent(SST::Event* ev);
+
+    uint64_t num_cycles;
+    uint32_t stop_rate;
+    uint32_t max_sleep;
+    bool     gate;
+
+    uint64_t ticks;
+    uint64_t checksum;
+    bool     done;
+    bool     stopping;
+
+    SST::RNG::MarsagliaRNG* rng;
+    SST::Link*              self_link;
+    Clock::HandlerBase*     clock_handler;
+    TimeConverter*          clock_tc;
+};
+
+} // namespace CoreTestClockBench
+} // namespace SST
+
+#endif // SST_CORE_CORETEST_CLOCKBENCH_H
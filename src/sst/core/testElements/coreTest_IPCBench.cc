@@ -0,0 +1,204 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_IPCBench.h"
+
+#include "sst/core/interprocess/shmchild.h"
+#include "sst/core/interprocess/shmparent.h"
+
+#include <algorithm>
+#include <chrono>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace SST;
+using namespace SST::CoreTestIPCBench;
+
+// Order dependent hash of the records, computed on both sides
+static inline uint64_t
+addToChecksum(uint64_t checksum, const IPCBenchRecord& record)
+{
+    return (checksum * 31) + (record.seq ^ record.data[0] ^ record.data[1] ^ record.data[2]);
+}
+
+coreTestIPCBench::coreTestIPCBench(ComponentId_t id, Params& params) :
+    Component(id),
+    expected_checksum(0),
+    received(0),
+    checksum(0)
+{
+    num_records = params.find<uint64_t>("num_records", 1000000);
+    batch_size  = params.find<uint64_t>("batch_size", 1);
+    buffer_size = params.find<uint64_t>("buffer_size", 1024);
+    verbose     = params.find<bool>("verbose", false);
+    check_clear = params.find<bool>("check_clear", false);
+
+    if ( batch_size == 0 ) batch_size = 1;
+    if ( buffer_size == 0 ) { getSimulationOutput().fatal(CALL_INFO, -1, "buffer_size must be at least 1\n"); }
+}
+
+coreTestIPCBench::coreTestIPCBench() : Component(-1)
+{
+    // for serialization only
+}
+
+void
+coreTestIPCBench::checkClear()
+{
+    SST::Core::Interprocess::SHMParent<IPCBenchTunnel> parent(getId(), 1, 4);
+    IPCBenchTunnel*                                    tunnel = parent.getTunnel();
+    IPCBenchRecord                                     record = {};
+    IPCBenchRecord                                     batch[4];
+
+    // Leave two unread records behind an index the reader has already
+    // seen, then clear them
+    record.seq = 1;
+    tunnel->writeMessage(0, record);
+    tunnel->readMessage(0);
+    record.seq = 2;
+    tunnel->writeMessage(0, record);
+    record.seq = 3;
+    tunnel->writeMessage(0, record);
+    tunnel->clearBuffer(0);
+
+    if ( tunnel->readMessageNB(0, &record) ) {
+        getSimulationOutput().fatal(CALL_INFO, -1, "Read a record from a cleared buffer\n");
+    }
+    if ( tunnel->readMessageBatchNB(0, batch, 4) != 0 ) {
+        getSimulationOutput().fatal(CALL_INFO, -1, "Read a batch of records from a cleared buffer\n");
+    }
+
+    // The whole buffer is free again, and no more than that
+    for ( uint64_t seq = 4; seq < 8; seq++ ) {
+        record.seq = seq;
+        if ( !tunnel->writeMessageNB(0, record) ) {
+            getSimulationOutput().fatal(CALL_INFO, -1, "Cleared buffer did not have room for 4 records\n");
+        }
+    }
+    if ( tunnel->writeMessageNB(0, record) ) {
+        getSimulationOutput().fatal(CALL_INFO, -1, "Cleared buffer took more than 4 records\n");
+    }
+    if ( tunnel->readMessageBatchNB(0, batch, 4) != 4 || batch[0].seq != 4 || batch[3].seq != 7 ) {
+        getSimulationOutput().fatal(CALL_INFO, -1, "Records written after clearing the buffer were not read back\n");
+    }
+
+    // Buffer sizes that aren't a power of two are rounded up, so all
+    // of the requested entries are usable
+    SST::Core::Interprocess::SHMParent<IPCBenchTunnel> odd_parent(getId(), 1, 5);
+    IPCBenchTunnel*                                    odd_tunnel = odd_parent.getTunnel();
+    IPCBenchRecord                                     odd_batch[5];
+    for ( uint64_t i = 0; i < 5; i++ ) {
+        odd_batch[i]     = record;
+        odd_batch[i].seq = i;
+    }
+    if ( odd_tunnel->writeMessageBatchNB(0, odd_batch, 5) != 5 ) {
+        getSimulationOutput().fatal(CALL_INFO, -1, "Buffer of 5 entries did not have room for 5 records\n");
+    }
+}
+
+void
+coreTestIPCBench::setup()
+{
+    if ( check_clear ) checkClear();
+
+    SST::Core::Interprocess::SHMParent<IPCBenchTunnel> parent(getId(), 1, buffer_size);
+    IPCBenchTunnel*                                    tunnel = parent.getTunnel();
+
+    // Don't let the reader inherit anything waiting to be printed
+    fflush(stdout);
+    fflush(stderr);
+
+    pid_t pid = fork();
+    if ( pid < 0 ) { getSimulationOutput().fatal(CALL_INFO, -1, "Unable to fork the reader process\n"); }
+    if ( pid == 0 ) {
+        runReader(parent.getRegionName());
+        _exit(0);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<IPCBenchRecord> batch(batch_size);
+    uint64_t                    seq = 0;
+    while ( seq < num_records ) {
+        size_t count = std::min(batch_size, num_records - seq);
+        for ( size_t i = 0; i < count; i++, seq++ ) {
+            IPCBenchRecord& record = batch[i];
+            record.seq             = seq;
+            record.data[0]         = seq * 3;
+            record.data[1]         = seq << 7;
+            record.data[2]         = ~seq;
+            expected_checksum      = addToChecksum(expected_checksum, record);
+        }
+
+        if ( batch_size == 1 )
+            tunnel->writeMessage(0, batch[0]);
+        else
+            tunnel->writeMessageBatch(0, batch.data(), count);
+    }
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if ( !WIFEXITED(status) || WEXITSTATUS(status) != 0 ) {
+        getSimulationOutput().fatal(CALL_INFO, -1, "Reader process did not finish cleanly\n");
+    }
+
+    received = tunnel->getSharedData()->received;
+    checksum = tunnel->getSharedData()->checksum;
+
+    if ( verbose ) {
+        printf(
+            "%s: %" PRIu64 " records in %.3f seconds, %.2f million records/s\n", getName().c_str(), num_records,
+            elapsed, num_records / elapsed / 1000000.0);
+    }
+}
+
+void
+coreTestIPCBench::runReader(const std::string& region)
+{
+    SST::Core::Interprocess::SHMChild<IPCBenchTunnel> child(region);
+    IPCBenchTunnel*                                   tunnel = child.getTunnel();
+
+    std::vector<IPCBenchRecord> batch(batch_size);
+    uint64_t                    count = 0;
+    uint64_t                    sum   = 0;
+    while ( count < num_records ) {
+        size_t num;
+        if ( batch_size == 1 ) {
+            batch[0] = tunnel->readMessage(0);
+            num      = 1;
+        }
+        else {
+            num = tunnel->readMessageBatch(0, batch.data(), std::min(batch_size, num_records - count));
+        }
+
+        for ( size_t i = 0; i < num; i++ ) {
+            sum = addToChecksum(sum, batch[i]);
+        }
+        count += num;
+    }
+
+    tunnel->getSharedData()->received = count;
+    tunnel->getSharedData()->checksum = sum;
+}
+
+void
+coreTestIPCBench::finish()
+{
+    printf(
+        "%s: received %" PRIu64 " of %" PRIu64 " records, checksum %s\n", getName().c_str(), received, num_records,
+        checksum == expected_checksum ? "matches" : "does not match");
+}
@@ -0,0 +1,107 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_IPCBENCH_H
+#define SST_CORE_CORETEST_IPCBENCH_H
+
+#include "sst/core/component.h"
+#include "sst/core/interprocess/tunneldef.h"
+
+#include <string>
+
+namespace SST {
+namespace CoreTestIPCBench {
+
+/** Record sent through the tunnel, about the size of an instrumentation command */
+struct IPCBenchRecord
+{
+    uint64_t seq;
+    uint64_t data[3];
+};
+
+/** Filled in by the reader process when it is done */
+struct IPCBenchResult
+{
+    uint64_t received;
+    uint64_t checksum;
+};
+
+typedef SST::Core::Interprocess::TunnelDef<IPCBenchResult, IPCBenchRecord> IPCBenchTunnel;
+
+/**
+ * Throughput benchmark for the interprocess circular buffers.  In
+ * setup() the component forks a reader process, which attaches to a
+ * shared memory tunnel, and then streams records to it either one at a
+ * time or in batches.  A checksum of what the reader received is
+ * printed at the end so runs with different batch sizes can be
+ * compared.  The rate is printed if verbose is set.  With check_clear
+ * set, it first checks clearBuffer() on a small buffer and stops with
+ * an error if anything can be read afterwards.
+ */
+class coreTestIPCBench : public SST::Component
+{
+public:
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestIPCBench,
+        "coreTestElement",
+        "coreTestIPCBench",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Interprocess tunnel throughput benchmark component",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "num_records", "Number of records to send to the reader process", "1000000" },
+        { "batch_size",  "Number of records written and read at a time.  1 uses the single record calls", "1" },
+        { "buffer_size", "Number of entries in the circular buffer", "1024" },
+        { "verbose",     "Print the time taken and the rate if set", "false" },
+        { "check_clear", "Check that clearing a buffer with unread records leaves it empty before the benchmark", "false" }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+    )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestIPCBench(SST::ComponentId_t id, SST::Params& params);
+    ~coreTestIPCBench() {}
+
+    void setup() override;
+    void finish() override;
+
+private:
+    coreTestIPCBench();                        // for serialization only
+    coreTestIPCBench(const coreTestIPCBench&); // do not implement
+    void operator=(const coreTestIPCBench&);   // do not implement
+
+    void runReader(const std::string& region);
+    void checkClear();
+
+    uint64_t num_records;
+    uint64_t batch_size;
+    uint64_t buffer_size;
+    bool     verbose;
+    bool     check_clear;
+
+    uint64_t expected_checksum;
+    uint64_t received;
+    uint64_t checksum;
+};
+
+} // namespace CoreTestIPCBench
+} // namespace SST
+
+#endif // SST_CORE_CORETEST_IPCBENCH_H
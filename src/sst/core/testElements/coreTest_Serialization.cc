@@ -213,6 +213,42 @@ coreTestSerialization::coreTestSerialization(ComponentId_t id, UNUSED(Params& pa
             out.output("ERROR: serializing as map<string,uintptr_t> and deserializing to "
                        "vector<pair<string,uintptr_t>> did not work properly\n");
     }
+
+    // Packing into a growable buffer
+
+    {
+        // Pack enough data to force the buffer to grow several times,
+        // then reuse the buffer for a smaller set of data
+        std::vector<char> buffer;
+        const size_t      offset = 12;
+        for ( int round = 0; round < 2; ++round ) {
+            std::vector<std::string> strings_in;
+            std::vector<int32_t>     ints_in;
+            for ( int i = 0; i < (round == 0 ? 5000 : 100); ++i ) {
+                strings_in.push_back(std::string(rng->generateNextUInt32() % 40, 'a' + (i % 26)));
+                ints_in.push_back(rng->generateNextInt32());
+            }
+
+            SST::Core::Serialization::serializer ser;
+            ser.start_sizing();
+            ser& strings_in;
+            ser& ints_in;
+            size_t size = ser.size();
+
+            ser.start_packing(buffer, offset);
+            ser& strings_in;
+            ser& ints_in;
+            passed = ser.size() == size && buffer.size() >= offset + size;
+
+            std::vector<std::string> strings_out;
+            std::vector<int32_t>     ints_out;
+            ser.start_unpacking(buffer.data() + offset, size);
+            ser& strings_out;
+            ser& ints_out;
+            if ( strings_in != strings_out || ints_in != ints_out ) passed = false;
+            if ( !passed ) out.output("ERROR: packing into a growable buffer did not work properly\n");
+        }
+    }
 }
 
 
@@ -0,0 +1,111 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_SyncBench.h"
+
+#include <string>
+
+using namespace SST;
+using namespace SST::CoreTestSyncBench;
+
+// Scramble the bits of x, so the delays and the checksum don't depend
+// on the order the events are handled in
+static uint64_t
+mix(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+coreTestSyncBench::coreTestSyncBench(ComponentId_t id, Params& params) : Component(id), handled(0), checksum(0)
+{
+    outstanding  = params.find<uint32_t>("outstanding", 10);
+    hops         = params.find<uint32_t>("hops", 1000);
+    max_delay    = params.find<uint32_t>("max_delay", 1000);
+    payload_size = params.find<size_t>("payload_size", 0);
+
+    if ( max_delay == 0 ) max_delay = 1;
+
+    // Connect to all the links
+    while ( true ) {
+        std::string port_name = "port" + std::to_string(links.size());
+        Link*       link      = configureLink(
+            port_name, "1ps",
+            new Event::Handler<coreTestSyncBench, size_t>(this, &coreTestSyncBench::handleEvent, links.size()));
+        if ( nullptr == link ) break;
+        links.push_back(link);
+    }
+
+    if ( links.empty() ) { getSimulationOutput().fatal(CALL_INFO, -1, "port0 must be connected\n"); }
+
+    // Events are handled alternately by the two ends of their link and
+    // both ends start outstanding events, so each end handles
+    // outstanding * hops events per link
+    expected = uint64_t(links.size()) * outstanding * hops;
+
+    // tell the simulator not to end without us
+    registerAsPrimaryComponent();
+    if ( expected > 0 ) primaryComponentDoNotEndSim();
+}
+
+coreTestSyncBench::coreTestSyncBench() : Component(-1)
+{
+    // for serialization only
+}
+
+void
+coreTestSyncBench::setup()
+{
+    if ( hops == 0 ) return;
+    for ( size_t port = 0; port < links.size(); port++ ) {
+        for ( uint32_t i = 0; i < outstanding; i++ ) {
+            uint64_t id = (getId() * links.size() + port) * outstanding + i;
+            links[port]->send(mix(id) % max_delay, new coreTestSyncBenchEvent(id, hops, payload_size));
+        }
+    }
+}
+
+void
+coreTestSyncBench::finish()
+{
+    printf("%s: handled %" PRIu64 " events, checksum = %" PRIu64 "\n", getName().c_str(), handled, checksum);
+}
+
+void
+coreTestSyncBench::handleEvent(Event* ev, size_t port)
+{
+    coreTestSyncBenchEvent* event = static_cast<coreTestSyncBenchEvent*>(ev);
+
+    for ( char c : event->payload ) {
+        if ( c != static_cast<char>(event->id) ) {
+            getSimulationOutput().fatal(
+                CALL_INFO, -1, "Payload of event %" PRIu64 " was corrupted on port%zu\n", event->id, port);
+        }
+    }
+
+    // Sum, so the checksum doesn't depend on the order of events that
+    // arrive at the same time
+    handled++;
+    checksum += mix(event->id ^ (getCurrentSimCycle() << 24) ^ event->hops);
+    if ( handled == expected ) primaryComponentOKToEndSim();
+
+    if ( --event->hops == 0 ) {
+        delete event;
+        return;
+    }
+    links[port]->send(mix(event->id + event->hops) % max_delay, event);
+}
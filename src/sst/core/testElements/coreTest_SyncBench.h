@@ -0,0 +1,122 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_SYNCBENCH_H
+#define SST_CORE_CORETEST_SYNCBENCH_H
+
+#include "sst/core/component.h"
+#include "sst/core/event.h"
+#include "sst/core/link.h"
+
+#include <vector>
+
+namespace SST {
+namespace CoreTestSyncBench {
+
+class coreTestSyncBenchEvent : public SST::Event
+{
+public:
+    coreTestSyncBenchEvent() : SST::Event(), id(0), hops(0) {}
+    coreTestSyncBenchEvent(uint64_t id, uint32_t hops, size_t payload_size) :
+        SST::Event(),
+        id(id),
+        hops(hops),
+        payload(payload_size, static_cast<char>(id))
+    {}
+
+    uint64_t id;
+    // Number of times the event is still to be sent back
+    uint32_t hops;
+    // Filled with the low byte of id, and checked on arrival
+    std::vector<char> payload;
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        Event::serialize_order(ser);
+        ser& id;
+        ser& hops;
+        ser& payload;
+    }
+
+    ImplementSerializable(SST::CoreTestSyncBench::coreTestSyncBenchEvent);
+};
+
+/**
+ * Benchmark for the queues that carry events between threads and
+ * ranks.  Each component keeps a number of events in flight on each
+ * of its links, and every event bounces back over the link it came
+ * in on until it runs out of hops.  Connect the components so most
+ * links cross threads or ranks to load the sync queues, and use
+ * --print-timing-info to compare run times.
+ *
+ * The delay added to each send only depends on the event, so the
+ * events handled and the checksum printed at the end are the same
+ * for any number of ranks and threads.
+ */
+class coreTestSyncBench : public SST::Component
+{
+public:
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestSyncBench,
+        "coreTestElement",
+        "coreTestSyncBench",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Thread and rank sync queue benchmark component",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "outstanding",  "Number of events sent on each link at the start of simulation", "10" },
+        { "hops",         "Number of times each event is sent back before it is deleted", "1000" },
+        { "max_delay",    "Maximum extra delay (in ps) added to each send", "1000" },
+        { "payload_size", "Number of bytes of payload carried by each event", "0" }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        { "port%d", "Links to other benchmark components.  Numbered from 0 with no gaps", { "coreTestSyncBench.coreTestSyncBenchEvent", "" } }
+    )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestSyncBench(SST::ComponentId_t id, SST::Params& params);
+    ~coreTestSyncBench() {}
+
+    void setup() override;
+    void finish() override;
+
+private:
+    coreTestSyncBench();                         // for serialization only
+    coreTestSyncBench(const coreTestSyncBench&); // do not implement
+    void operator=(const coreTestSyncBench&);    // do not implement
+
+    void handleEvent(SST::Event* ev, size_t port);
+
+    uint32_t outstanding;
+    uint32_t hops;
+    uint32_t max_delay;
+    size_t   payload_size;
+
+    uint64_t expected;
+    uint64_t handled;
+    uint64_t checksum;
+
+    std::vector<SST::Link*> links;
+};
+
+} // namespace CoreTestSyncBench
+} // namespace SST
+
+#endif // SST_CORE_CORETEST_SYNCBENCH_H
@@ -0,0 +1,121 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_TimeVortexBench.h"
+
+using namespace SST;
+using namespace SST::CoreTestTimeVortexBench;
+
+uint64_t coreTestTimeVortexBench::delivered = 0;
+
+coreTestTimeVortexBench::coreTestTimeVortexBench(ComponentId_t id, Params& params) :
+    Component(id),
+    handled(0),
+    checksum(0)
+{
+    std::string mode = params.find<std::string>("mode", "hold");
+    outstanding      = params.find<uint64_t>("outstanding", 100);
+    num_events       = params.find<uint64_t>("num_events", 100000);
+    max_delay        = params.find<uint32_t>("max_delay", 1000);
+    global_order     = params.find<bool>("global_order", false);
+    burst_size       = params.find<uint64_t>("burst_size", 200);
+    burst_every      = params.find<uint64_t>("burst_every", 500);
+    burst_delay      = params.find<uint32_t>("burst_delay", 4);
+    uint32_t seed    = params.find<uint32_t>("seed", 1);
+
+    if ( max_delay == 0 ) max_delay = 1;
+
+    rng = new SST::RNG::MarsagliaRNG(seed, id + 1);
+
+    // tell the simulator not to end without us
+    registerAsPrimaryComponent();
+    primaryComponentDoNotEndSim();
+
+    if ( mode == "hold" || mode == "burst" ) {
+        link = configureSelfLink(
+            "self", "1ps", new Event::Handler<coreTestTimeVortexBench>(this, &coreTestTimeVortexBench::handleEvent));
+    }
+    else if ( mode == "exchange" ) {
+        link = configureLink(
+            "port", "1ps", new Event::Handler<coreTestTimeVortexBench>(this, &coreTestTimeVortexBench::handleEvent));
+        if ( !link ) { getSimulationOutput().fatal(CALL_INFO, -1, "exchange mode requires port to be connected\n"); }
+    }
+    else {
+        getSimulationOutput().fatal(CALL_INFO, -1, "Unknown mode: %s\n", mode.c_str());
+    }
+
+    // Only burst mode sends extra events
+    if ( mode != "burst" ) burst_size = 0;
+    if ( burst_every == 0 ) burst_every = 1;
+    if ( burst_delay == 0 ) burst_delay = 1;
+}
+
+coreTestTimeVortexBench::~coreTestTimeVortexBench()
+{
+    delete rng;
+}
+
+coreTestTimeVortexBench::coreTestTimeVortexBench() : Component(-1)
+{
+    // for serialization only
+}
+
+void
+coreTestTimeVortexBench::setup()
+{
+    for ( uint64_t i = 0; i < outstanding; ++i ) {
+        link->send(rng->generateNextUInt32() % max_delay, new coreTestTimeVortexBenchEvent(getId() * outstanding + i));
+    }
+
+    // Never delivered, but keeps the time range of the events wide
+    if ( burst_size > 0 ) {
+        link->send((SimTime_t)max_delay * 1000000, new coreTestTimeVortexBenchEvent(getId() * outstanding, true));
+    }
+}
+
+void
+coreTestTimeVortexBench::finish()
+{
+    printf("%s: handled %" PRIu64 " events, checksum = %" PRIu64 "\n", getName().c_str(), handled, checksum);
+}
+
+void
+coreTestTimeVortexBench::handleEvent(Event* ev)
+{
+    coreTestTimeVortexBenchEvent* event = static_cast<coreTestTimeVortexBenchEvent*>(ev);
+
+    // Keep the events moving once we're done so that the peer in
+    // exchange mode doesn't starve, but stop counting them.
+    bool burst = false;
+    if ( handled < num_events ) {
+        // Order dependent hash of what was delivered when
+        checksum = (checksum * 31) + (getCurrentSimCycle() ^ event->id);
+        if ( global_order ) checksum = (checksum * 31) + delivered++;
+        handled++;
+        if ( handled == num_events ) { primaryComponentOKToEndSim(); }
+        burst = burst_size > 0 && handled % burst_every == 0;
+    }
+
+    if ( event->extra ) {
+        delete event;
+        return;
+    }
+
+    if ( burst ) {
+        for ( uint64_t i = 0; i < burst_size; ++i ) {
+            link->send(rng->generateNextUInt32() % burst_delay, new coreTestTimeVortexBenchEvent(event->id, true));
+        }
+    }
+
+    link->send(rng->generateNextUInt32() % max_delay, event);
+}
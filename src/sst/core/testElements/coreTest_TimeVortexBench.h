@@ -0,0 +1,126 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_TIMEVORTEXBENCH_H
+#define SST_CORE_CORETEST_TIMEVORTEXBENCH_H
+
+#include "sst/core/component.h"
+#include "sst/core/event.h"
+#include "sst/core/link.h"
+#include "sst/core/rng/marsaglia.h"
+
+namespace SST {
+namespace CoreTestTimeVortexBench {
+
+class coreTestTimeVortexBenchEvent : public SST::Event
+{
+public:
+    coreTestTimeVortexBenchEvent() : SST::Event(), id(0), extra(false) {}
+    coreTestTimeVortexBenchEvent(uint64_t id, bool extra = false) : SST::Event(), id(id), extra(extra) {}
+
+    uint64_t id;
+    // Sent in a burst, so not rescheduled when delivered
+    bool     extra;
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        Event::serialize_order(ser);
+        ser& id;
+        ser& extra;
+    }
+
+    ImplementSerializable(SST::CoreTestTimeVortexBench::coreTestTimeVortexBenchEvent);
+};
+
+/**
+ * Microbenchmark for TimeVortex implementations.  Keeps a fixed
+ * number of events in flight and reschedules each one with a random
+ * delay when it is delivered.  In hold mode events are sent on a
+ * self link, in exchange mode they bounce between two components.
+ * Burst mode is hold mode with one event kept far in the future and a
+ * burst of extra events sent every so often, which piles many events
+ * onto a few nearby times.  That makes the ladder TimeVortex split
+ * buckets into finer rungs and overflow its bottom list.
+ * A checksum of the delivery order is printed at the end so runs with
+ * different TimeVortex implementations can be compared.  With
+ * global_order set, the checksum also covers the order of deliveries
+ * across all the components, which needs a single thread.
+ */
+class coreTestTimeVortexBench : public SST::Component
+{
+public:
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestTimeVortexBench,
+        "coreTestElement",
+        "coreTestTimeVortexBench",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex hold/exchange benchmark component",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "mode",        "Workload to run: hold (self link), exchange (events bounce over the port) or burst (hold with bursts of extra events)", "hold" },
+        { "outstanding", "Number of events each component keeps in flight", "100" },
+        { "num_events",  "Number of events to handle before the component allows the simulation to end", "100000" },
+        { "max_delay",   "Maximum random delay (in ps) added to each rescheduled event", "1000" },
+        { "seed",        "Seed for the random delays", "1" },
+        { "global_order", "Include the order of deliveries to all components in the checksum.  Only for serial runs", "false" },
+        { "burst_size",  "Number of extra events sent in each burst, used in burst mode", "200" },
+        { "burst_every", "Number of events handled between bursts, used in burst mode", "500" },
+        { "burst_delay", "Maximum random delay (in ps) added to the events in a burst", "4" }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        { "port", "Link to the peer component, used in exchange mode", { "coreTestTimeVortexBench.coreTestTimeVortexBenchEvent", "" } }
+    )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestTimeVortexBench(SST::ComponentId_t id, SST::Params& params);
+    ~coreTestTimeVortexBench();
+
+    void setup() override;
+    void finish() override;
+
+private:
+    coreTestTimeVortexBench();                               // for serialization only
+    coreTestTimeVortexBench(const coreTestTimeVortexBench&); // do not implement
+    void operator=(const coreTestTimeVortexBench&);          // do not implement
+
+    void handleEvent(SST::Event* ev);
+
+    uint64_t outstanding;
+    uint64_t num_events;
+    uint32_t max_delay;
+    bool     global_order;
+    uint64_t burst_size;
+    uint64_t burst_every;
+    uint32_t burst_delay;
+
+    // Deliveries to all the components, used with global_order
+    static uint64_t delivered;
+
+    uint64_t handled;
+    uint64_t checksum;
+
+    SST::RNG::MarsagliaRNG* rng;
+    SST::Link*              link;
+};
+
+} // namespace CoreTestTimeVortexBench
+} // namespace SST
+
+#endif // SST_CORE_CORETEST_TIMEVORTEXBENCH_H
@@ -0,0 +1,96 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_UntimedRing.h"
+
+using namespace SST;
+using namespace SST::CoreTestUntimedRing;
+
+coreTestUntimedRing::coreTestUntimedRing(ComponentId_t id, Params& params) :
+    Component(id),
+    init_tokens(0),
+    init_phase_sum(0),
+    init_calls(0),
+    complete_tokens(0),
+    complete_phase_sum(0),
+    complete_calls(0)
+{
+    start        = params.find<bool>("start", false);
+    hops         = params.find<uint32_t>("hops", 10);
+    count_phases = params.find<bool>("count_phases", false);
+
+    left  = configureLink("left");
+    right = configureLink("right");
+    if ( nullptr == left || nullptr == right ) {
+        getSimulationOutput().fatal(CALL_INFO, -1, "Both the left and right ports must be connected\n");
+    }
+}
+
+coreTestUntimedRing::coreTestUntimedRing() : Component(-1)
+{
+    // for serialization only
+}
+
+uint64_t
+coreTestUntimedRing::passTokens(unsigned int phase, Link* in, Link* out, uint64_t& phase_sum)
+{
+    uint64_t tokens = 0;
+    while ( Event* ev = in->recvUntimedData() ) {
+        coreTestUntimedRingEvent* token = static_cast<coreTestUntimedRingEvent*>(ev);
+        tokens++;
+        phase_sum += phase;
+        if ( --token->hops > 0 )
+            out->sendUntimedData(token);
+        else
+            delete token;
+    }
+    return tokens;
+}
+
+void
+coreTestUntimedRing::init(unsigned int phase)
+{
+    if ( phase == 0 && start && hops > 0 ) right->sendUntimedData(new coreTestUntimedRingEvent(hops));
+    init_tokens += passTokens(phase, left, right, init_phase_sum);
+
+    if ( count_phases ) {
+        init_calls++;
+        requestUntimedPhase();
+    }
+}
+
+void
+coreTestUntimedRing::complete(unsigned int phase)
+{
+    if ( phase == 0 && start && hops > 0 ) left->sendUntimedData(new coreTestUntimedRingEvent(hops));
+    complete_tokens += passTokens(phase, right, left, complete_phase_sum);
+
+    if ( count_phases ) {
+        complete_calls++;
+        requestUntimedPhase();
+    }
+}
+
+void
+coreTestUntimedRing::finish()
+{
+    printf(
+        "%s: init received %" PRIu64 " tokens (phase sum %" PRIu64 "), complete received %" PRIu64
+        " tokens (phase sum %" PRIu64 ")\n",
+        getName().c_str(), init_tokens, init_phase_sum, complete_tokens, complete_phase_sum);
+    if ( count_phases ) {
+        printf(
+            "%s: init called %" PRIu64 " times, complete called %" PRIu64 " times\n", getName().c_str(), init_calls,
+            complete_calls);
+    }
+}
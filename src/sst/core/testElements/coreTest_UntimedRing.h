@@ -0,0 +1,112 @@
+// Copyright 2009-2023 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2023, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_UNTIMEDRING_H
+#define SST_CORE_CORETEST_UNTIMEDRING_H
+
+#include "sst/core/component.h"
+#include "sst/core/event.h"
+#include "sst/core/link.h"
+
+namespace SST {
+namespace CoreTestUntimedRing {
+
+class coreTestUntimedRingEvent : public SST::Event
+{
+public:
+    coreTestUntimedRingEvent() : SST::Event(), hops(0) {}
+    coreTestUntimedRingEvent(uint32_t hops) : SST::Event(), hops(hops) {}
+
+    // Number of hops the token has left
+    uint32_t hops;
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        Event::serialize_order(ser);
+        ser& hops;
+    }
+
+    ImplementSerializable(SST::CoreTestUntimedRing::coreTestUntimedRingEvent);
+};
+
+/**
+ * Passes tokens around a ring of components with untimed data, to the
+ * right during init and to the left during complete.  Each token is
+ * passed on in the phase after it arrives, so most components have
+ * nothing to do in most phases.  With count_phases set, the component
+ * asks to be called in every phase and prints how many times it was
+ * called, which is the same with and without --untimed-quiescence.
+ */
+class coreTestUntimedRing : public SST::Component
+{
+public:
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestUntimedRing,
+        "coreTestElement",
+        "coreTestUntimedRing",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Untimed phase benchmark component",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "start",        "Send a token in phase 0 of init and complete", "false" },
+        { "hops",         "Number of hops each token makes", "10" },
+        { "count_phases", "Ask to be called in every phase and print the number of calls", "false" }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        { "left",  "Link to the previous component in the ring", { "coreTestUntimedRing.coreTestUntimedRingEvent", "" } },
+        { "right", "Link to the next component in the ring", { "coreTestUntimedRing.coreTestUntimedRingEvent", "" } }
+    )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestUntimedRing(SST::ComponentId_t id, SST::Params& params);
+    ~coreTestUntimedRing() {}
+
+    void init(unsigned int phase) override;
+    void complete(unsigned int phase) override;
+    void finish() override;
+
+private:
+    coreTestUntimedRing();                           // for serialization only
+    coreTestUntimedRing(const coreTestUntimedRing&); // do not implement
+    void operator=(const coreTestUntimedRing&);      // do not implement
+
+    // Pass on the tokens that arrived on in to out.  Returns the
+    // number of tokens that arrived.
+    uint64_t passTokens(unsigned int phase, SST::Link* in, SST::Link* out, uint64_t& phase_sum);
+
+    bool     start;
+    uint32_t hops;
+    bool     count_phases;
+
+    SST::Link* left;
+    SST::Link* right;
+
+    uint64_t init_tokens;
+    uint64_t init_phase_sum;
+    uint64_t init_calls;
+    uint64_t complete_tokens;
+    uint64_t complete_phase_sum;
+    uint64_t complete_calls;
+};
+
+} // namespace CoreTestUntimedRing
+} // namespace SST
+
+#endif // SST_CORE_CORETEST_UNTIMEDRING_H
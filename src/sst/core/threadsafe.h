@@ -21,8 +21,10 @@
 #define sst_pause() __asm__ __volatile__("or 27, 27, 27" ::: "memory");
 #endif
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <thread>
 #include <vector>
@@ -44,22 +46,200 @@ namespace ThreadSafe {
 #define CACHE_ALIGNED_T           alignas(64)
 #endif
 
+/**
+ * Barrier for the threads on a rank.
+ *
+ * Threads arrive either on a single shared counter (Central) or on a
+ * combining tree of counters (Tree), so that only a few threads
+ * contend for each cache line.  In both cases the last thread to
+ * arrive releases the others by incrementing the generation.  The
+ * WaitPolicy controls what waiting threads do while they wait for the
+ * release.
+ *
+ * The type and wait policy are read from the defaults when the
+ * Barrier is constructed or resized.  The Tree barrier requires each
+ * thread to have set a unique index with setThreadIndex().
+ */
 class CACHE_ALIGNED_T Barrier
 {
+public:
+    enum class Type { Central, Tree };
+
+    enum class WaitPolicy {
+        Spin,  /*!< Busy wait */
+        Yield, /*!< Busy wait, then yield the core */
+        Sleep, /*!< Busy wait, then yield, then sleep in short intervals */
+        Block  /*!< Busy wait, then yield, then block until released */
+    };
+
+private:
+    // Number of children of each node in the Tree barrier
+    static constexpr size_t tree_fan_in = 4;
+
+    struct CACHE_ALIGNED_T Node
+    {
+        std::atomic<size_t> count;
+        size_t              expected;
+        size_t              parent; // index of the parent, or the node itself for the root
+    };
+
+    static inline Type                       default_type   = Type::Central;
+    static inline WaitPolicy                 default_policy = WaitPolicy::Sleep;
+    static inline thread_local uint32_t      thread_index   = 0;
+
     size_t              origCount;
     std::atomic<bool>   enabled;
     std::atomic<size_t> count, generation;
 
+    Type       type;
+    WaitPolicy policy;
+
+    std::unique_ptr<Node[]> tree;
+
+    // Only used with WaitPolicy::Block
+    std::atomic<size_t>     sleepers;
+    std::mutex              mtx;
+    std::condition_variable cv;
+
+    void buildTree()
+    {
+        tree.reset();
+        // The root of a central barrier already has every thread as a
+        // child, so only build the tree when it has more than one level
+        if ( type != Type::Tree || origCount <= tree_fan_in ) return;
+
+        // Each level has one node per tree_fan_in children in the
+        // level below.  The leaves have the threads as children.
+        std::vector<size_t> widths;
+        size_t              total = 0;
+        for ( size_t children = origCount; children > 1; children = widths.back() ) {
+            widths.push_back((children + tree_fan_in - 1) / tree_fan_in);
+            total += widths.back();
+        }
+        tree.reset(new Node[total]);
+
+        size_t children    = origCount;
+        size_t level_start = 0;
+        for ( size_t width : widths ) {
+            for ( size_t i = 0; i < width; i++ ) {
+                Node& node    = tree[level_start + i];
+                node.expected = std::min(tree_fan_in, children - i * tree_fan_in);
+                node.count.store(node.expected);
+                // The next level starts right after this one
+                node.parent   = width == 1 ? level_start : level_start + width + i / tree_fan_in;
+            }
+            level_start += width;
+            children = width;
+        }
+    }
+
+    // Returns true if this thread was the last to arrive
+    bool arrive()
+    {
+        if ( !tree ) {
+            if ( count.fetch_sub(1) != 1 ) return false;
+            count.store(origCount);
+            return true;
+        }
+
+        size_t index = thread_index / tree_fan_in;
+        while ( true ) {
+            Node& node = tree[index];
+            if ( node.count.fetch_sub(1, std::memory_order_acq_rel) != 1 ) return false;
+            // Last to arrive at this node, so reset it and move up.
+            // Nobody can arrive here again until after the release.
+            node.count.store(node.expected, std::memory_order_relaxed);
+            if ( node.parent == index ) return true;
+            index = node.parent;
+        }
+    }
+
+    void release()
+    {
+        asm("" ::: "memory");
+        /* Incrementing generation causes release */
+        generation.fetch_add(1);
+        __sync_synchronize();
+        if ( policy == WaitPolicy::Block && sleepers.load() > 0 ) {
+            // Take the lock so no waiter can be between checking the
+            // generation and going to sleep
+            { std::lock_guard<std::mutex> lock(mtx); }
+            cv.notify_all();
+        }
+    }
+
+    void waitForRelease(size_t gen)
+    {
+        /* Try spinning first */
+        uint32_t count = 0;
+        do {
+            count++;
+            if ( count < 1024 || policy == WaitPolicy::Spin ) { sst_pause(); }
+            else if ( count < (1024 * 1024) || policy == WaitPolicy::Yield ) {
+                std::this_thread::yield();
+            }
+            else if ( policy == WaitPolicy::Sleep ) {
+                struct timespec ts;
+                ts.tv_sec  = 0;
+                ts.tv_nsec = 1000;
+                nanosleep(&ts, nullptr);
+            }
+            else {
+                std::unique_lock<std::mutex> lock(mtx);
+                sleepers.fetch_add(1);
+                while ( gen == generation.load() ) {
+                    cv.wait(lock);
+                }
+                sleepers.fetch_sub(1);
+                return;
+            }
+        } while ( gen == generation.load(std::memory_order_acquire) );
+    }
+
 public:
-    Barrier(size_t count) : origCount(count), enabled(true), count(count), generation(0) {}
+    Barrier(size_t count) :
+        origCount(count),
+        enabled(true),
+        count(count),
+        generation(0),
+        type(default_type),
+        policy(default_policy),
+        sleepers(0)
+    {
+        buildTree();
+    }
 
     // Come g++ 4.7, this can become a delegating constructor
-    Barrier() : origCount(0), enabled(false), count(0), generation(0) {}
+    Barrier() :
+        origCount(0),
+        enabled(false),
+        count(0),
+        generation(0),
+        type(default_type),
+        policy(default_policy),
+        sleepers(0)
+    {}
+
+    /** Set the type and wait policy used by Barriers constructed or
+     * resized after this call */
+    static void setDefaults(Type type, WaitPolicy policy)
+    {
+        default_type   = type;
+        default_policy = policy;
+    }
+
+    /** Set the index of the calling thread.  Each thread that waits on
+     * a Tree barrier must have a unique index less than the barrier
+     * count. */
+    static void setThreadIndex(uint32_t index) { thread_index = index; }
 
     /** ONLY call this while nobody is in wait() */
     void resize(size_t newCount)
     {
         count = origCount = newCount;
+        type              = default_type;
+        policy            = default_policy;
+        buildTree();
         generation.store(0);
         enabled.store(true);
     }
@@ -76,31 +256,12 @@ public:
 
             size_t gen = generation.load(std::memory_order_acquire);
             asm("" ::: "memory");
-            size_t c = count.fetch_sub(1) - 1;
-            if ( 0 == c ) {
+            if ( arrive() ) {
                 /* We should release */
-                count.store(origCount);
-                asm("" ::: "memory");
-                /* Incrementing generation causes release */
-                generation.fetch_add(1, std::memory_order_release);
-                __sync_synchronize();
+                release();
             }
             else {
-                /* Try spinning first */
-                uint32_t count = 0;
-                do {
-                    count++;
-                    if ( count < 1024 ) { sst_pause(); }
-                    else if ( count < (1024 * 1024) ) {
-                        std::this_thread::yield();
-                    }
-                    else {
-                        struct timespec ts;
-                        ts.tv_sec  = 0;
-                        ts.tv_nsec = 1000;
-                        nanosleep(&ts, nullptr);
-                    }
-                } while ( gen == generation.load(std::memory_order_acquire) );
+                waitForRelease(gen);
             }
             elapsed = SST::Core::Profile::getElapsed(startTime);
         }
@@ -112,6 +273,10 @@ public:
         enabled.store(false);
         count.store(0);
         ++generation;
+        if ( policy == WaitPolicy::Block ) {
+            { std::lock_guard<std::mutex> lock(mtx); }
+            cv.notify_all();
+        }
     }
 };
 
@@ -44,6 +44,14 @@ public:
     virtual uint64_t getMaxDepth() const { return max_depth; }
     virtual uint64_t getCurrentDepth() const = 0;
 
+    /** Use up the next queue order number without inserting anything,
+     * so activities kept outside the TimeVortex can be ordered with
+     * the ones in it.  Only valid if supportsQueueOrder() is true. */
+    virtual uint64_t takeQueueOrder() { return 0; }
+    /** Whether takeQueueOrder() hands out the TimeVortex's insertion
+     * count.  Needed by --fifo-links. */
+    virtual bool     supportsQueueOrder() const { return false; }
+
 protected:
     uint64_t max_depth;
 };
@@ -0,0 +1,43 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+# Benchmark for many components sharing one clock.  Use
+# --print-timing-info to compare run times.
+#
+# Usage: sst test_ClockBench.py --model-options="[num_components] [num_cycles] [stop_rate] [max_sleep] [gate] [subcomponent_link]"
+
+num_comps = 100
+num_cycles = 10000
+stop_rate = 0
+max_sleep = 10
+gate = "false"
+subcomponent_link = "false"
+
+if len(sys.argv) > 1: num_comps = int(sys.argv[1])
+if len(sys.argv) > 2: num_cycles = int(sys.argv[2])
+if len(sys.argv) > 3: stop_rate = int(sys.argv[3])
+if len(sys.argv) > 4: max_sleep = int(sys.argv[4])
+if len(sys.argv) > 5: gate = sys.argv[5]
+if len(sys.argv) > 6: subcomponent_link = sys.argv[6]
+
+for i in range(num_comps):
+    comp = sst.Component("bench%d"%i, "coreTestElement.coreTestClockBench")
+    comp.addParams({
+        "clock" : "2GHz",
+        "num_cycles" : num_cycles,
+        "stop_rate" : stop_rate,
+        "max_sleep" : max_sleep,
+        "gate" : gate,
+        "seed" : i + 1,
+        "subcomponent_link" : subcomponent_link
+    })
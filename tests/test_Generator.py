@@ -0,0 +1,101 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+# Builds the same torus as test_MessageMesh.py using sst.generate(),
+# so that with parallel load each rank only builds its own components
+
+# Define SST core options
+sst.setProgramOption("stop-at", "10us")
+
+x_size = int(sys.argv[1])
+y_size = int(sys.argv[2])
+
+# With "scatter", the components are spread unevenly over the ranks
+# and no links are no-cut, so a partitioner that supports parallel
+# loading has components to move between ranks
+scatter = len(sys.argv) > 3 and sys.argv[3] == "scatter"
+
+# With "rows", whole rows of the torus are dealt out to the ranks and
+# each rank is told which components are its own, so no rank has to
+# ask for the rank of every component
+rows = len(sys.argv) > 3 and sys.argv[3] == "rows"
+
+num_routers = x_size * y_size
+
+# Port subcomponents of each component that was built on this rank
+ports = dict()
+
+def build(i):
+    comp = sst.Component("component%d"%i, "coreTestElement.message_mesh.enclosing_component")
+    comp.addParam("id",i)
+
+    # X ports will use MessagePort directly, Y ports, will use the SlotPort
+    port_x_pos = comp.setSubComponent("ports","coreTestElement.message_mesh.message_port",0)
+    port_x_neg = comp.setSubComponent("ports","coreTestElement.message_mesh.message_port",1)
+
+    tmp = comp.setSubComponent("ports","coreTestElement.message_mesh.port_slot",2)
+    port_y_pos = tmp.setSubComponent("port","coreTestElement.message_mesh.message_port")
+
+    tmp = comp.setSubComponent("ports","coreTestElement.message_mesh.port_slot",3)
+    port_y_neg = tmp.setSubComponent("port","coreTestElement.message_mesh.message_port")
+
+    comp.setSubComponent("route","coreTestElement.message_mesh.route_message")
+
+    ports[i] = { "x+" : port_x_pos, "x-" : port_x_neg, "y+" : port_y_pos, "y-" : port_y_neg }
+    return comp
+
+def neighbors(i):
+    my_x = i % x_size
+    my_y = i // x_size
+    return [ (my_y * x_size + (my_x + 1) % x_size, "x+"),
+             (my_y * x_size + (my_x - 1) % x_size, "x-"),
+             (((my_y + 1) % y_size) * x_size + my_x, "y+"),
+             (((my_y - 1) % y_size) * x_size + my_x, "y-") ]
+
+opposite = { "x+" : "x-", "x-" : "x+", "y+" : "y-", "y-" : "y+" }
+
+def position(i):
+    return "x%dy%d"%(i % x_size, i // x_size)
+
+def connect(i, comp_i, j, comp_j, direction):
+    # Name the link from its positive end, as test_MessageMesh.py does
+    if direction.endswith("+"):
+        pos, neg = i, j
+    else:
+        pos, neg = j, i
+    link = sst.Link("link_%s_%s"%(position(pos), position(neg)))
+    link.connect( (ports[i][direction], "port", "1ns"), (ports[j][opposite[direction]], "port", "1ns") )
+
+    # Set the nocut attribute on positive x-link on every other router
+    if direction[0] == "x" and pos % 2 == 0 and not scatter:
+        link.setNoCut()
+
+def scattered_rank(i):
+    # Put most of the components on rank 0 and spread the rest
+    if (i * 2654435761) % 97 < 60:
+        return 0
+    return (i * 40503) % 7 % sst.getMPIRankCount()
+
+def row_rank(i):
+    return (i // x_size) % sst.getMPIRankCount()
+
+def row_local(rank):
+    for y in range(rank, y_size, sst.getMPIRankCount()):
+        yield from range(y * x_size, (y + 1) * x_size)
+
+if scatter:
+    sst.generate(num_routers, build, neighbors, connect, scattered_rank)
+elif rows:
+    sst.generate(num_routers, build, neighbors, connect, row_rank, row_local)
+else:
+    sst.generate(num_routers, build, neighbors, connect)
@@ -0,0 +1,39 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+# Throughput benchmark for the interprocess circular buffers.  The
+# component forks a reader process and streams records to it through a
+# shared memory tunnel.  Set verbose to print the rate.
+#
+# Usage: sst test_IPCBench.py --model-options="[num_records] [batch_size] [buffer_size] [verbose] [check_clear]"
+
+num_records = 1000000
+batch_size = 1
+buffer_size = 1024
+verbose = "false"
+check_clear = "false"
+
+if len(sys.argv) > 1: num_records = int(sys.argv[1])
+if len(sys.argv) > 2: batch_size = int(sys.argv[2])
+if len(sys.argv) > 3: buffer_size = int(sys.argv[3])
+if len(sys.argv) > 4: verbose = sys.argv[4]
+if len(sys.argv) > 5: check_clear = sys.argv[5]
+
+comp = sst.Component("bench", "coreTestElement.coreTestIPCBench")
+comp.addParams({
+    "num_records" : num_records,
+    "batch_size" : batch_size,
+    "buffer_size" : buffer_size,
+    "verbose" : verbose,
+    "check_clear" : check_clear
+})
@@ -18,6 +18,11 @@ sst.setProgramOption("stop-at", "10us")
 x_size = int(sys.argv[1])
 y_size = int(sys.argv[2])
 
+# Optional latency for the y-dim links
+y_latency = "1ns"
+if len(sys.argv) > 3:
+    y_latency = sys.argv[3]
+
 # Calculate number of routers and endpoints
 num_routers = x_size * y_size
         
@@ -75,10 +80,10 @@ for i in range(num_routers):
     their_y = my_y + 1
     if their_y == y_size:
         their_y = 0
-    port_y_pos.addLink(getLink("x%dy%d"%(my_x,my_y), "x%dy%d"%(my_x,their_y)), "port", "1ns")
+    port_y_pos.addLink(getLink("x%dy%d"%(my_x,my_y), "x%dy%d"%(my_x,their_y)), "port", y_latency)
 
     # Negative
     their_y = my_y - 1
     if their_y == -1:
         their_y = y_size - 1
-    port_y_neg.addLink(getLink("x%dy%d"%(my_x,their_y), "x%dy%d"%(my_x,my_y)), "port", "1ns")
+    port_y_neg.addLink(getLink("x%dy%d"%(my_x,their_y), "x%dy%d"%(my_x,my_y)), "port", y_latency)
@@ -0,0 +1,55 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+# Events bouncing over links between distant components, so with the
+# default linear partitioner most of the traffic goes through the
+# thread and rank sync queues.  Run with different numbers of threads
+# and ranks and use --print-timing-info to compare run times.
+#
+# Usage: sst test_SyncBench.py --model-options="[num_components] [peers] [outstanding] [hops] [payload_size] [latency]"
+
+num_comps = 16
+peers = 2
+outstanding = 10
+hops = 1000
+payload_size = 16
+latency = "1ns"
+
+if len(sys.argv) > 1: num_comps = int(sys.argv[1])
+if len(sys.argv) > 2: peers = int(sys.argv[2])
+if len(sys.argv) > 3: outstanding = int(sys.argv[3])
+if len(sys.argv) > 4: hops = int(sys.argv[4])
+if len(sys.argv) > 5: payload_size = int(sys.argv[5])
+if len(sys.argv) > 6: latency = sys.argv[6]
+
+# Each peer has to be a different component
+if num_comps < peers + 1:
+    num_comps = peers + 1
+
+comps = []
+for i in range(num_comps):
+    comp = sst.Component("bench%d"%i, "coreTestElement.coreTestSyncBench")
+    comp.addParams({
+        "outstanding" : outstanding,
+        "hops" : hops,
+        "payload_size" : payload_size
+    })
+    comps.append(comp)
+
+# Component i uses port k for its k-th peer and port peers + k for
+# the component that has i as its k-th peer
+for i in range(num_comps):
+    for k in range(peers):
+        j = (i + (k + 1) * num_comps // (peers + 1)) % num_comps
+        link = sst.Link("link_%d_%d"%(i, k))
+        link.connect( (comps[i], "port%d"%k, latency), (comps[j], "port%d"%(peers + k), latency) )
@@ -0,0 +1,62 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+# Hold/exchange microbenchmark for the TimeVortex.  Select the
+# TimeVortex with --timeVortex and use --print-timing-info to compare
+# run times.
+#
+# Usage: sst test_TimeVortex.py --model-options="<hold|exchange|burst> [num_components] [outstanding] [num_events] [max_delay] [latency] [back_latency] [global_order]"
+
+mode = "hold"
+num_comps = 4
+outstanding = 100
+num_events = 20000
+max_delay = 1000
+latency = "1ns"
+back_latency = None
+global_order = "false"
+
+if len(sys.argv) > 1: mode = sys.argv[1]
+if len(sys.argv) > 2: num_comps = int(sys.argv[2])
+if len(sys.argv) > 3: outstanding = int(sys.argv[3])
+if len(sys.argv) > 4: num_events = int(sys.argv[4])
+if len(sys.argv) > 5: max_delay = int(sys.argv[5])
+if len(sys.argv) > 6: latency = sys.argv[6]
+if len(sys.argv) > 7: back_latency = sys.argv[7]
+if len(sys.argv) > 8: global_order = sys.argv[8]
+
+# Exchange mode links have latency one way and back_latency the other
+if back_latency is None:
+    back_latency = latency
+
+# Exchange mode needs pairs of components
+if mode == "exchange" and num_comps % 2 == 1:
+    num_comps += 1
+
+comps = []
+for i in range(num_comps):
+    comp = sst.Component("bench%d"%i, "coreTestElement.coreTestTimeVortexBench")
+    comp.addParams({
+        "mode" : mode,
+        "outstanding" : outstanding,
+        "num_events" : num_events,
+        "max_delay" : max_delay,
+        "seed" : i + 1,
+        "global_order" : global_order
+    })
+    comps.append(comp)
+
+if mode == "exchange":
+    for i in range(0, num_comps, 2):
+        link = sst.Link("link_%d_%d"%(i, i + 1))
+        link.connect( (comps[i], "port", latency), (comps[i + 1], "port", back_latency) )
@@ -0,0 +1,41 @@
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+# Ring of components passing tokens with untimed data during init and
+# complete.  Use --verbose to see the time and number of messages for
+# each phase, and --untimed-quiescence to only call the components
+# that have tokens waiting.
+#
+# Usage: sst test_UntimedRing.py --model-options="[num_components] [num_tokens] [hops]"
+
+num_comps = 100
+num_tokens = 1
+hops = 100
+
+if len(sys.argv) > 1: num_comps = int(sys.argv[1])
+if len(sys.argv) > 2: num_tokens = int(sys.argv[2])
+if len(sys.argv) > 3: hops = int(sys.argv[3])
+
+comps = []
+for i in range(num_comps):
+    comp = sst.Component("ring%d"%i, "coreTestElement.coreTestUntimedRing")
+    comp.addParams({
+        "start" : "true" if i * num_tokens % num_comps < num_tokens else "false",
+        "hops" : hops,
+        "count_phases" : "true" if i == 0 else "false"
+    })
+    comps.append(comp)
+
+for i in range(num_comps):
+    link = sst.Link("link%d"%i)
+    link.connect( (comps[i], "right", "1ns"), (comps[(i + 1) % num_comps], "left", "1ns") )
@@ -0,0 +1,96 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import os
+import sys
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+class testcase_ClockBench(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+###
+
+    def test_ClockBench_steady(self):
+        self.clockbench_test_template("steady", "50 2000 0")
+
+    def test_ClockBench_stop(self):
+        self.clockbench_test_template("stop", "50 2000 5 10")
+
+    # Gating the clocks gives the same ticks as stopping and restarting
+    # them by hand
+    def test_ClockBench_gate(self):
+        self.clockbench_test_template("stop", "50 2000 5 10 true", "gate")
+
+    # The wakeup events arrive on a SubComponent's link
+    def test_ClockBench_gate_subcomponent(self):
+        self.clockbench_test_template("stop", "50 2000 5 10 true true", "gate_subcomponent")
+
+    def test_ClockBench_gate_profile(self):
+        self.clockbench_test_template("gate_profile", "50 2000 5 10 true",
+            other_args="--enable-profiling=\"clocks:sst.profile.handler.clock.count(level=type)[clock]\"")
+
+#####
+
+    def clockbench_test_template(self, reftype, model_options, testtype = None, other_args = ""):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+        if testtype is None:
+            testtype = reftype
+
+        # Set the various file paths
+        sdlfile = "{0}/test_ClockBench.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_ClockBench_{1}.out".format(testsuitedir, reftype)
+        outfile = "{0}/test_ClockBench_{1}.out".format(outdir, testtype)
+
+        # Each component prints how many ticks it saw and a checksum of
+        # the cycles, which doesn't depend on the order handlers are
+        # called in
+        options = "--model-options=\"{0}\" {1}".format(model_options, other_args)
+        self.run_sst(sdlfile, outfile, other_args=options, num_ranks=1, num_threads=1)
+
+        # Perform the test
+        cmp_result = testing_compare_sorted_diff(testtype, outfile, reffile)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
@@ -0,0 +1,84 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import os
+import sys
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+class testcase_IPCBench(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+###
+
+    def test_ipc_batch(self):
+        self.ipcbench_test_template("batch", "200000 1 1024", "200000 64 1024")
+
+    def test_ipc_small_buffer(self):
+        self.ipcbench_test_template("small_buffer", "20000 1 1024", "20000 3 5")
+
+    # Stops with an error if records can be read from a cleared buffer
+    def test_ipc_clear(self):
+        self.ipcbench_test_template("clear", "20000 1 1024", "20000 1 1024 false true")
+
+#####
+
+    def ipcbench_test_template(self, testtype, options_ref, options_check):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        # Set the various file paths
+        sdlfile = "{0}/test_IPCBench.py".format(testsuitedir)
+        outfile_ref = "{0}/test_ipcbench_ref_{1}.out".format(outdir, testtype)
+        outfile_check = "{0}/test_ipcbench_check_{1}.out".format(outdir, testtype)
+
+        # The reference sends one record at a time.  Each run prints
+        # whether the reader's checksum matched what was sent.
+        self.run_sst(sdlfile, outfile_ref, other_args="--model-options=\"{0}\"".format(options_ref), num_ranks=1, num_threads=1)
+        self.run_sst(sdlfile, outfile_check, other_args="--model-options=\"{0}\"".format(options_check), num_ranks=1, num_threads=1)
+
+        # Perform the test
+        cmp_result = testing_compare_sorted_diff(testtype, outfile_ref, outfile_check)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_check, outfile_ref))
@@ -0,0 +1,113 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import os
+import sys
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+have_mpi = sst_core_config_include_file_get_value_int("SST_CONFIG_HAVE_MPI", default=0, disable_warning=True) == 1
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+class testcase_RankSync(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+###
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_shared_memory_mesh(self):
+        self.ranksync_test_template("shared_memory_mesh", "test_MessageMesh.py", "6 6", "--shared-memory-ranks", 4, 1)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_shared_memory_mesh_threads(self):
+        self.ranksync_test_template("shared_memory_mesh_threads", "test_MessageMesh.py", "6 6", "--shared-memory-ranks", 2, 2)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_shared_memory_exchange(self):
+        self.ranksync_test_template("shared_memory_exchange", "test_TimeVortex.py", "exchange 4 100 20000", "--shared-memory-ranks", 4, 1)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_async_mesh(self):
+        self.ranksync_test_template("async_mesh", "test_MessageMesh.py", "6 6", "--async-rank-sync", 4, 1)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_async_mesh_threads(self):
+        self.ranksync_test_template("async_mesh_threads", "test_MessageMesh.py", "6 6", "--async-rank-sync", 4, 2)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_async_exchange(self):
+        self.ranksync_test_template("async_exchange", "test_TimeVortex.py", "exchange 4 100 20000", "--async-rank-sync", 4, 1)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_peer_lookahead_mesh(self):
+        self.ranksync_test_template("peer_lookahead_mesh", "test_MessageMesh.py", "4 4 4ns", "--per-peer-lookahead", 3, 1)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_peer_lookahead_exchange(self):
+        self.ranksync_test_template("peer_lookahead_exchange", "test_TimeVortex.py", "exchange 4 100 20000", "--per-peer-lookahead", 4, 1)
+
+    def test_tree_barrier_mesh(self):
+        self.ranksync_test_template("tree_barrier_mesh", "test_MessageMesh.py", "6 6", "--barrier-type=tree --barrier-wait=block", 1, 8)
+
+#####
+
+    def ranksync_test_template(self, testtype, sdl, model_options, sync_options, ranks, threads):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        options_ref = "--model-options=\"{0}\"".format(model_options)
+        options_check = "--model-options=\"{0}\" {1}".format(model_options, sync_options)
+
+        # Set the various file paths
+        sdlfile = "{0}/{1}".format(testsuitedir, sdl)
+        outfile_ref = "{0}/test_ranksync_ref_{1}.out".format(outdir, testtype)
+        outfile_check = "{0}/test_ranksync_check_{1}.out".format(outdir, testtype)
+
+        # The default RankSync is the reference
+        self.run_sst(sdlfile, outfile_ref, other_args=options_ref, num_ranks=ranks, num_threads=threads)
+        self.run_sst(sdlfile, outfile_check, other_args=options_check, num_ranks=ranks, num_threads=threads)
+
+        # Perform the test
+        cmp_result = testing_compare_sorted_diff(testtype, outfile_ref, outfile_check)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_check, outfile_ref))
@@ -0,0 +1,125 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import os
+import sys
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+have_mpi = sst_core_config_include_file_get_value_int("SST_CONFIG_HAVE_MPI", default=0, disable_warning=True) == 1
+
+# mpirun binds each rank to as many cores as it has threads
+num_cores = host_os_get_num_cores_on_system()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+class testcase_SyncBench(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+###
+
+    # With the linear partitioner, most links cross threads, and with
+    # more than one rank, every thread sends to the other ranks
+    def test_SyncBench(self):
+        self.syncbench_test_template("default")
+
+    def test_SyncBench_threads_2(self):
+        self.syncbench_test_template("threads_2", num_ranks=1, num_threads=2)
+
+    def test_SyncBench_threads_4(self):
+        self.syncbench_test_template("threads_4", num_ranks=1, num_threads=4)
+
+    # Larger thread counts use enough components to give every thread
+    # some, and only run when there is a core for each thread
+    @unittest.skipIf(num_cores < 8, "Test needs 8 cores")
+    def test_SyncBench_threads_8(self):
+        self.syncbench_test_template("threads_8", num_ranks=1, num_threads=8, num_comps=64)
+
+    @unittest.skipIf(num_cores < 16, "Test needs 16 cores")
+    def test_SyncBench_threads_16(self):
+        self.syncbench_test_template("threads_16", num_ranks=1, num_threads=16, num_comps=64)
+
+    @unittest.skipIf(num_cores < 32, "Test needs 32 cores")
+    def test_SyncBench_threads_32(self):
+        self.syncbench_test_template("threads_32", num_ranks=1, num_threads=32, num_comps=64)
+
+    @unittest.skipIf(num_cores < 64, "Test needs 64 cores")
+    def test_SyncBench_threads_64(self):
+        self.syncbench_test_template("threads_64", num_ranks=1, num_threads=64, num_comps=64)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    @unittest.skipIf(num_cores < 2, "Test needs 2 cores")
+    def test_SyncBench_ranks_2(self):
+        self.syncbench_test_template("ranks_2", num_ranks=2, num_threads=1)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    @unittest.skipIf(num_cores < 4, "Test needs 4 cores")
+    def test_SyncBench_ranks_2_threads_2(self):
+        self.syncbench_test_template("ranks_2_threads_2", num_ranks=2, num_threads=2)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    @unittest.skipIf(num_cores < 8, "Test needs 8 cores")
+    def test_SyncBench_ranks_2_threads_4(self):
+        self.syncbench_test_template("ranks_2_threads_4", num_ranks=2, num_threads=4)
+
+#####
+
+    def syncbench_test_template(self, testtype, num_ranks = None, num_threads = None, num_comps = None):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        # Set the various file paths
+        sdlfile = "{0}/test_SyncBench.py".format(testsuitedir)
+        outfile = "{0}/test_SyncBench_{1}.out".format(outdir, testtype)
+        if num_comps is None:
+            reffile = "{0}/refFiles/test_SyncBench.out".format(testsuitedir)
+            options = ""
+        else:
+            reffile = "{0}/refFiles/test_SyncBench_{1}.out".format(testsuitedir, num_comps)
+            options = "--model-options=\"{0}\"".format(num_comps)
+
+        self.run_sst(sdlfile, outfile, other_args=options, num_ranks=num_ranks, num_threads=num_threads)
+
+        # Perform the test
+        cmp_result = testing_compare_sorted_diff(testtype, outfile, reffile)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
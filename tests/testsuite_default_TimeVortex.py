@@ -0,0 +1,122 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import os
+import sys
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+class testcase_TimeVortex(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+###
+
+
+    def test_ladder_hold(self):
+        self.timevortex_test_template("ladder_hold", "hold", "sst.timevortex.ladder")
+
+    def test_ladder_exchange(self):
+        self.timevortex_test_template("ladder_exchange", "exchange", "sst.timevortex.ladder")
+
+    # Bursts of events on a few nearby times, with one event far in the
+    # future keeping the coarse rungs wide, make the ladder split
+    # buckets into finer rungs and overflow its bottom list.  The
+    # global delivery order has to match the priority queue.
+    def test_ladder_burst(self):
+        self.timevortex_test_template("ladder_burst", "burst 4 100 20000 1000 1ns 1ns true", "sst.timevortex.ladder")
+
+    def test_keyed_heap_hold(self):
+        self.timevortex_test_template("keyed_heap_hold", "hold", "sst.timevortex.keyed_heap")
+
+    def test_keyed_heap_exchange(self):
+        self.timevortex_test_template("keyed_heap_exchange", "exchange", "sst.timevortex.keyed_heap")
+
+    def test_binned_map_hold(self):
+        self.timevortex_test_template("binned_map_hold", "hold", "sst.timevortex.map.binned")
+
+    def test_binned_map_exchange(self):
+        self.timevortex_test_template("binned_map_exchange", "exchange", "sst.timevortex.map.binned")
+
+    def test_fifo_links_hold(self):
+        self.timevortex_test_template("fifo_links_hold", "hold 4 100 20000 4", "sst.timevortex.priority_queue", "--fifo-links")
+
+    def test_fifo_links_exchange(self):
+        self.timevortex_test_template("fifo_links_exchange", "exchange 8 100 20000 2", "sst.timevortex.ladder", "--fifo-links")
+
+    # Zero delay events one way tie with extra delay events sent later
+    # the other way, since the two directions share a tag.  The global
+    # delivery order has to match the TimeVortex alone.
+    def test_fifo_links_bidirectional(self):
+        self.timevortex_test_template("fifo_links_bidirectional", "exchange 2 100 20000 2 2ps 1ps true", "sst.timevortex.priority_queue", "--fifo-links")
+
+    # Linear partitioning puts pairs 0-1 and 4-5 on one thread each and
+    # splits 2-3, so the thread safe TimeVortex gets inserts from the
+    # other thread while its own thread adds to the FIFOs.
+    def test_fifo_links_interthread(self):
+        self.timevortex_test_template("fifo_links_interthread", "exchange 6 100 20000 2", "sst.timevortex.priority_queue", "--fifo-links --interthread-links --partitioner=sst.linear", num_threads=2)
+
+#####
+
+    def timevortex_test_template(self, testtype, model_options, timevortex, extra_options="", num_threads=1):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        options_ref = "--model-options=\"{0}\" --timeVortex=sst.timevortex.priority_queue".format(model_options)
+        options_check = "--model-options=\"{0}\" --timeVortex={1} {2}".format(model_options, timevortex, extra_options)
+
+        # Set the various file paths
+        sdlfile = "{0}/test_TimeVortex.py".format(testsuitedir)
+        outfile_ref = "{0}/test_timevortex_ref_{1}.out".format(outdir, testtype)
+        outfile_check = "{0}/test_timevortex_check_{1}.out".format(outdir, testtype)
+
+        # The priority_queue TimeVortex on a single thread is the
+        # reference.  Delivery order is checked through the checksums
+        # printed by each component.
+        self.run_sst(sdlfile, outfile_ref, other_args=options_ref, num_ranks=1, num_threads=1)
+        self.run_sst(sdlfile, outfile_check, other_args=options_check, num_ranks=1, num_threads=num_threads)
+
+        # Perform the test
+        cmp_result = testing_compare_sorted_diff(testtype, outfile_ref, outfile_check)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_check, outfile_ref))
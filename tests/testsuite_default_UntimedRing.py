@@ -0,0 +1,83 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2023 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2023, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import os
+import sys
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+class testcase_UntimedRing(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+###
+
+    def test_UntimedRing(self):
+        self.untimedring_test_template("default")
+
+    # Only calling the components with tokens waiting gives the same
+    # tokens in the same phases
+    def test_UntimedRing_quiescence(self):
+        self.untimedring_test_template("quiescence", "--untimed-quiescence")
+
+    def test_UntimedRing_quiescence_threads(self):
+        self.untimedring_test_template("quiescence_threads", "--untimed-quiescence", num_threads=2)
+
+#####
+
+    def untimedring_test_template(self, testtype, other_args = "", num_threads = None):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        # Set the various file paths
+        sdlfile = "{0}/test_UntimedRing.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_UntimedRing.out".format(testsuitedir)
+        outfile = "{0}/test_UntimedRing_{1}.out".format(outdir, testtype)
+
+        options = "--model-options=\"20 3 50\" {0}".format(other_args)
+        self.run_sst(sdlfile, outfile, other_args=options, num_threads=num_threads)
+
+        # Perform the test
+        cmp_result = testing_compare_sorted_diff(testtype, outfile, reffile)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
@@ -75,14 +75,63 @@ class testcase_Config_input_output(SSTTestCase):
     def test_json_io_parallel(self):
         self.configio_test_template("json_io_parallel", "6 6", "json", True, "MULTI")
 
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_json_io_parallel_single(self):
+        self.configio_test_template("json_io_parallel_single", "6 6", "json", "SINGLE", "SINGLE")
+
+    def test_binary_io(self):
+        self.configio_test_template("binary_io", "6 6", "sstb", False, "NONE")
+
+    def test_binary_io_comp(self):
+        self.configio_test_template("binary_io_comp", "", "sstb", False, "NONE", True)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_binary_io_parallel(self):
+        self.configio_test_template("binary_io_parallel", "6 6", "sstb", True, "MULTI")
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_binary_single_parallel_load(self):
+        self.configio_test_template("binary_single_parallel_load", "6 6", "sstb", False, "SINGLE")
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_json_single_parallel_load(self):
+        self.configio_test_template("json_single_parallel_load", "6 6", "json", False, "SINGLE")
 
     @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
     def test_python_single_parallel_load(self):
         self.configio_test_template("python_single_parallel_load", "6 6", "py", False, "SINGLE")
 
+    def test_python_generator_parallel_load(self):
+        self.generator_test_template("generator", "")
+
+    # The generator is given the components of each rank
+    def test_python_generator_local_parallel_load(self):
+        self.generator_test_template("generator_local", "rows")
 
 #####
 
+    def generator_test_template(self, testtype, generator_options):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        options_ref = "--model-options=\"6 6\""
+        if have_mpi:
+            options_check = "--parallel-load=SINGLE --model-options=\"6 6 {0}\"".format(generator_options)
+        else:
+            options_check = "--model-options=\"6 6 {0}\"".format(generator_options)
+
+        # The generator builds the same model as test_MessageMesh.py
+        sdlfile_ref = "{0}/test_MessageMesh.py".format(testsuitedir)
+        sdlfile_check = "{0}/test_Generator.py".format(testsuitedir)
+        outfile_ref = "{0}/test_configio_ref_{1}.out".format(outdir, testtype)
+        outfile_check = "{0}/test_configio_check_{1}.out".format(outdir, testtype)
+
+        self.run_sst(sdlfile_ref, outfile_ref, other_args=options_ref)
+        self.run_sst(sdlfile_check, outfile_check, other_args=options_check)
+
+        cmp_result = testing_compare_sorted_diff(testtype, outfile_ref, outfile_check)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_ref, outfile_check))
+
     def configio_test_template(self, testtype, model_options, output_type, parallel_io, load_mode, use_component_test=False):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
@@ -90,11 +139,15 @@ class testcase_Config_input_output(SSTTestCase):
         output_config = "{0}/test_configio_{1}.{2}".format(outdir,testtype,output_type)
         if ( output_type == "py" ): out_flag = "--output-config"
         elif ( output_type == "json"): out_flag = "--output-json"
+        elif ( output_type == "sstb"): out_flag = "--output-binary"
         else:
             print("Unknown output type: {0}".format(output_type))
             sys.exit(1)
 
-        if parallel_io:
+        # parallel_io can also name the mode to pass to --parallel-output
+        if isinstance(parallel_io, str):
+            options_ref = "{0}={1} --parallel-output={2} --model-options=\"{3}\"".format(out_flag,output_config,parallel_io,model_options);
+        elif parallel_io:
             options_ref = "{0}={1} --parallel-output --model-options=\"{2}\"".format(out_flag,output_config,model_options);
         else:
             options_ref = "{0}={1} --output-partition --model-options=\"{2}\"".format(out_flag,output_config,model_options);
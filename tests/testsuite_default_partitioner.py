@@ -23,6 +23,8 @@ from sst_unittest_support import *
 module_init = 0
 module_sema = threading.Semaphore()
 
+have_mpi = sst_core_config_include_file_get_value_int("SST_CONFIG_HAVE_MPI", default=0, disable_warning=True) == 1
+
 def initializeTestModule_SingleInstance(class_inst):
     global module_init
     global module_sema
@@ -63,13 +65,72 @@ class testcase_Partitioners(SSTTestCase):
     def test_simple(self):
         self.partitioner_test_template("simple", "6 6", "sst.simple")
 
+    def test_multilevel(self):
+        self.partitioner_test_template("multilevel", "6 6", "sst.multilevel")
+
+    def test_latency(self):
+        self.partitioner_test_template("latency", "6 6", "sst.latency")
+
+    def test_latency_tolerance(self):
+        self.partitioner_test_template("latency_tolerance", "6 6 1.5ns", "sst.latency", "--imbalance-tolerance=0.5")
+
+    def test_labelprop(self):
+        self.partitioner_test_template("labelprop", "6 6", "sst.labelprop")
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_labelprop_parallel_load(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        # The generator builds the same model as test_MessageMesh.py, but
+        # scatters the components over the ranks, so the partitioner
+        # moves components between ranks after the parallel load
+        sdlfile_ref = "{0}/test_MessageMesh.py".format(testsuitedir)
+        sdlfile_check = "{0}/test_Generator.py".format(testsuitedir)
+        outfile_ref = "{0}/test_partitioner_ref_labelprop_parallel_load.out".format(outdir)
+        outfile_check = "{0}/test_partitioner_check_labelprop_parallel_load.out".format(outdir)
+
+        options_ref = "--model-options=\"8 8\""
+        options_check = "--parallel-load=SINGLE --partitioner=sst.labelprop --model-options=\"8 8 scatter\""
+        self.run_sst(sdlfile_ref, outfile_ref, other_args=options_ref, num_ranks=1, num_threads=1)
+        self.run_sst(sdlfile_check, outfile_check, other_args=options_check)
+
+        cmp_result = testing_compare_sorted_diff("labelprop_parallel_load", outfile_ref, outfile_check)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_ref, outfile_check))
+
+    def test_component_weights(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        weightfile = "{0}/test_partitioner_weights.txt".format(outdir)
+        outfile_record = "{0}/test_partitioner_record_weights.out".format(outdir)
+        outfile_ref = "{0}/test_partitioner_ref_weights.out".format(outdir)
+        outfile_check = "{0}/test_partitioner_check_weights.out".format(outdir)
+
+        # Record the handler time of each component
+        options = "--model-options=\"6 6\" --output-component-weights={0}".format(weightfile)
+        self.run_sst(sdlfile, outfile_record, other_args=options, num_ranks=1, num_threads=1)
+
+        with open(weightfile) as fp:
+            weights = [line for line in fp if not line.startswith("#")]
+        self.assertEqual(len(weights), 36, "Weights file {0} does not list all 36 components".format(weightfile))
+
+        # Partition using the recorded weights
+        options = "--model-options=\"6 6\" --partitioner=sst.multilevel --component-weights={0}".format(weightfile)
+        self.run_sst(sdlfile, outfile_ref, other_args=options, num_ranks=1, num_threads=1)
+        self.run_sst(sdlfile, outfile_check, other_args=options)
+
+        cmp_result = testing_compare_sorted_diff("weights", outfile_ref, outfile_check)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_ref, outfile_check))
+
 #####
 
-    def partitioner_test_template(self, testtype, model_options, partitioner):
+    def partitioner_test_template(self, testtype, model_options, partitioner, extra_args=""):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
-        options = "--model-options=\"{0}\" --partitioner={1}".format(model_options, partitioner);
+        options = "--model-options=\"{0}\" --partitioner={1} {2}".format(model_options, partitioner, extra_args);
         
         # Set the various file paths
         sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)